@@ -1,19 +1,14 @@
 import re
+import sys
+
+ON_COLOR = '0xff0000ff'
 
 def convert_to_font_pattern(pattern):
     entries = [entry.strip().lower() for entry in pattern.split(',') if entry.strip()]
     if len(entries) != 64:
         raise ValueError("Padrão inválido. Esperado 64 entradas (8x8).")
     rows = [entries[i*8 : (i+1)*8] for i in range(8)]
-    bytes_array = []
-    for x in range(8):
-        byte = 0
-        for y in range(8):
-            if rows[y][x] == '0xff0000ff':
-                byte |= (1 << y)
-        bytes_array.append(byte)
-    hex_values = [f"0x{byte:02x}" for byte in bytes_array]
-    return ", ".join(hex_values)
+    return "\n".join("".join('#' if entry == ON_COLOR else '.' for entry in row) for row in rows)
 
 def convert_multiple_font_patterns(input_text):
     blocks = re.findall(r'\{([^}]+)\}', input_text)
@@ -24,6 +19,175 @@ def convert_multiple_font_patterns(input_text):
         results.append(result)
     return results
 
+# Animações: cada bloco {...} é um quadro de largura x altura entradas ARGB
+# (formato exportado pelo Piskel). Sem blocos, os quadros são lidos como
+# texto: linhas só de '#' (aceso) e '.', quadros separados por uma linha em
+# branco e as demais linhas ignoradas. Os quadros viram colunas no formato do
+# display (uma coluna = altura/8 bytes consecutivos, bit 0 no topo), o
+# primeiro é gravado inteiro e os demais como XOR com o anterior, todos
+# comprimidos com RLE. O resultado é lido por bibliotecas/animation.c.
+#
+# Cabeçalho: 'A' 'N' largura páginas quadros(u16) intervalo_ms(u16)
+# Quadro:    flags (bit 0 = quadro-chave) tamanho(u16) dados
+# Dados:     c & 0x80 -> (c & 0x7f) + 1 cópias do próximo byte
+#            senão    -> c + 1 bytes literais
+ANIMATION_KEYFRAME = 0x01
+
+def convert_to_columns(pixels, width, height):
+    if len(pixels) != width * height:
+        raise ValueError(f"Quadro inválido. Esperado {width * height} entradas ({width}x{height}).")
+    pages = (height + 7) // 8
+    columns = []
+    for x in range(width):
+        for page in range(pages):
+            byte = 0
+            for bit in range(8):
+                y = page * 8 + bit
+                if y < height and pixels[y * width + x]:
+                    byte |= (1 << bit)
+            columns.append(byte)
+    return columns
+
+def piskel_frames(input_text):
+    frames = []
+    for block in re.findall(r'\{([^}]+)\}', input_text):
+        entries = [entry.strip().lower() for entry in block.replace('\n', ' ').split(',') if entry.strip()]
+        frames.append([entry == ON_COLOR for entry in entries])
+    return frames
+
+def text_frames(input_text):
+    frames, rows = [], []
+    for line in input_text.splitlines() + ['']:
+        line = line.strip()
+        if line and not set(line) - set('#.'):
+            rows.append(line)
+            continue
+        if not line and rows:
+            if len(set(len(row) for row in rows)) != 1:
+                raise ValueError(f"Quadro {len(frames) + 1}: linhas de larguras diferentes.")
+            frames.append(rows)
+            rows = []
+    if not frames:
+        return [], 0, 0
+    width, height = len(frames[0][0]), len(frames[0])
+    return [[c == '#' for row in rows for c in row] for rows in frames], width, height
+
+def rle_encode(data):
+    out = []
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run >= 3:
+            out += [0x80 | (run - 1), data[i]]
+            i += run
+            continue
+        # Literais até o próximo trecho repetido de 3 ou mais bytes
+        start = i
+        while i < len(data) and i - start < 128:
+            if i + 2 < len(data) and data[i] == data[i + 1] == data[i + 2]:
+                break
+            i += 1
+        out += [i - start - 1] + data[start:i]
+    return out
+
+def convert_animation(input_text, width, height, interval_ms):
+    pixels = piskel_frames(input_text)
+    if not pixels:
+        pixels, width, height = text_frames(input_text)
+    if not pixels:
+        raise ValueError("Nenhum quadro encontrado.")
+    frames = [convert_to_columns(frame, width, height) for frame in pixels]
+
+    pages = (height + 7) // 8
+    out = [ord('A'), ord('N'), width, pages,
+           len(frames) & 0xff, len(frames) >> 8, interval_ms & 0xff, interval_ms >> 8]
+    previous = None
+    for frame in frames:
+        if previous is None:
+            flags, data = ANIMATION_KEYFRAME, rle_encode(frame)
+        else:
+            flags, data = 0, rle_encode([a ^ b for a, b in zip(frame, previous)])
+        out += [flags, len(data) & 0xff, len(data) >> 8] + data
+        previous = frame
+    return out, len(frames) * width * pages
+
+def format_c_array(name, data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join(f"0x{byte:02x}" for byte in data[i:i + 16]) + ",")
+    return f"static const uint8_t {name}[] = {{\n" + "\n".join(lines) + "\n};"
+
+def option(args, name, default):
+    if name in args:
+        return args[args.index(name) + 1]
+    return default
+
+# Fonte: bibliotecas/font.txt (glyphs desenhados em texto, ver o cabeçalho
+# de lá) vira bibliotecas/font.c, com o índice por código Latin-1, as colunas
+# de cada glyph no formato do display e a faixa de colunas acesas usada pelo
+# texto proporcional (ver bibliotecas/font.h).
+FONT_CODES = 256
+
+def parse_font(input_text):
+    glyphs = []  # (código, nome, colunas, largura fixa ou None)
+    index = {}   # código -> glyph
+    aliases = []
+    lines = [line.rstrip() for line in input_text.splitlines()]
+    i = 0
+    while i < len(lines):
+        fields = lines[i].split()
+        i += 1
+        if not fields or fields[0].startswith('#'):
+            continue
+        if not fields[0].startswith('U+'):
+            raise ValueError(f"Linha {i}: esperado U+XXXX.")
+        code = int(fields[0][2:], 16)
+        if code >= FONT_CODES or code in index or code in dict(aliases):
+            raise ValueError(f"U+{code:04X} fora do Latin-1 ou repetido.")
+        if len(fields) > 2 and fields[-2] == '=' and fields[-1].startswith('U+'):
+            aliases.append((code, int(fields[-1][2:], 16)))
+            continue
+        rows = lines[i:i + 8]
+        i += 8
+        if len(rows) != 8 or any(len(row) != 8 or set(row) - set('#.') for row in rows):
+            raise ValueError(f"U+{code:04X}: esperado 8 linhas de 8 colunas com '#' e '.'.")
+        columns = [sum(1 << y for y in range(8) if rows[y][x] == '#') for x in range(8)]
+        width = next((int(field[8:]) for field in fields if field.startswith('largura=')), None)
+        name = ' '.join(field for field in fields[1:] if not field.startswith('largura='))
+        index[code] = len(glyphs)
+        glyphs.append((code, name, columns, width))
+    for code, target in aliases:
+        index[code] = index[target]
+    if index.get(0x20) != 0:
+        raise ValueError("O espaço (U+0020) precisa ser o primeiro glyph.")
+    return index, glyphs
+
+def glyph_metrics(columns, width):
+    lit = [x for x, column in enumerate(columns) if column]
+    left = lit[0] if lit else 0
+    if width is None:
+        width = lit[-1] - left + 1 if lit else 0
+    return left, width
+
+def format_font(index, glyphs, source):
+    out = [f"// Gerado por \"Criar letras e animações via priskel.py\" --fonte {source}; não editar à mão.",
+           '#include "font.h"',
+           '',
+           f"// {len(index)} códigos em {len(glyphs)} glyphs; os demais usam o espaço",
+           "const uint8_t font_index[FONT_CODES] = {"]
+    for row in range(0, FONT_CODES, 16):
+        codes = ", ".join(f"{index.get(code, 0):3d}" for code in range(row, row + 16))
+        out.append(f"    {codes}, // 0x{row:02x}")
+    out += ["};", "", "const font_glyph_t font_glyphs[] = {"]
+    for code, name, columns, width in glyphs:
+        left, width = glyph_metrics(columns, width)
+        hex_values = ", ".join(f"0x{column:02x}" for column in columns)
+        out.append(f"    {{{{{hex_values}}}, {left}, {width}}}, // {name} (U+{code:04X})")
+    out.append("};")
+    return "\n".join(out)
+
 # Entrada com múltiplos padrões
 pattern_input = """
 {
@@ -288,8 +452,34 @@ pattern_input = """
 }
 """
 
-# Processa e imprime no formato desejado
-results = convert_multiple_font_patterns(pattern_input)
-print("Padrões convertidos para font.h:")
-for result in results:
-    print(f"{result},")
\ No newline at end of file
+# Uso:
+#   python3 "Criar letras e animações via priskel.py"
+#       imprime os padrões acima como glyphs para bibliotecas/font.txt
+#   python3 "Criar letras e animações via priskel.py" --fonte bibliotecas/font.txt > bibliotecas/font.c
+#       gera a fonte (índice Latin-1, glyphs e larguras) a partir do texto
+#   python3 "Criar letras e animações via priskel.py" --animacao [arquivo]
+#           [--largura 8] [--altura 8] [--intervalo 100] [--nome animacao] [--cor 0xff0000ff]
+#       imprime um array C com a animação comprimida (sem arquivo, usa os
+#       padrões acima como quadros; quadros em texto dão largura e altura)
+args = sys.argv[1:]
+if '--animacao' in args:
+    ON_COLOR = option(args, '--cor', ON_COLOR).lower()
+    source = option(args, '--animacao', None)
+    text = open(source).read() if source and not source.startswith('--') else pattern_input
+    width = int(option(args, '--largura', 8))
+    height = int(option(args, '--altura', 8))
+    data, raw_size = convert_animation(text, width, height, int(option(args, '--intervalo', 100)))
+    print(f"// Gerado por \"Criar letras e animações via priskel.py\" --animacao: {raw_size} bytes de quadros em {len(data)}")
+    print(format_c_array(option(args, '--nome', 'animacao'), data))
+elif '--fonte' in args:
+    source = option(args, '--fonte', 'bibliotecas/font.txt')
+    index, glyphs = parse_font(open(source, encoding='utf-8').read())
+    print(format_font(index, glyphs, source))
+else:
+    # Processa e imprime no formato desejado
+    results = convert_multiple_font_patterns(pattern_input)
+    print("Padrões convertidos para bibliotecas/font.txt (trocar U+XXXX pelo código):")
+    for result in results:
+        print("U+XXXX")
+        print(result)
+        print()
\ No newline at end of file
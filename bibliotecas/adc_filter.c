@@ -0,0 +1,57 @@
+#include "adc_filter.h"
+
+void adc_filter_init(adc_filter_t *filter, uint16_t oversample)
+{
+  filter->oversample = oversample ? oversample : 1;
+  filter->outputs = 0;
+  for (uint8_t channel = 0; channel < ADC_FILTER_CHANNELS; ++channel)
+  {
+    filter->sum[channel] = 0;
+    filter->count[channel] = 0;
+    filter->output[channel] = 0;
+  }
+}
+
+// Consome amostras intercaladas (first_channel, first_channel + 1, ...).
+// Retorna quantos valores completos foram produzidos nesta chamada; um valor
+// fica completo quando o último canal fecha sua janela de média.
+uint32_t adc_filter_push(adc_filter_t *filter, const uint16_t *samples, size_t count, uint8_t first_channel)
+{
+  uint32_t produced = 0;
+  uint8_t channel = first_channel % ADC_FILTER_CHANNELS;
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    filter->sum[channel] += samples[i] & 0x0FFF;
+    if (++filter->count[channel] == filter->oversample)
+    {
+      filter->output[channel] = (filter->sum[channel] + filter->oversample / 2) / filter->oversample;
+      filter->sum[channel] = 0;
+      filter->count[channel] = 0;
+      if (channel == ADC_FILTER_CHANNELS - 1)
+        produced++;
+    }
+    channel = (channel + 1 == ADC_FILTER_CHANNELS) ? 0 : channel + 1;
+  }
+
+  filter->outputs += produced;
+  return produced;
+}
+
+// Consome as amostras de um anel de tamanho par entre read_index e
+// write_index, dando a volta se preciso; o canal de cada amostra é a sua
+// posição no anel (o DMA começa no canal 0). Retorna os valores completos
+// produzidos nos dois trechos juntos, já que um valor pode fechar no trecho
+// antes da volta e o seguinte não fechar nenhum.
+uint32_t adc_filter_push_ring(adc_filter_t *filter, const uint16_t *ring, size_t size, size_t read_index,
+                              size_t write_index)
+{
+  uint32_t produced = 0;
+  if (write_index < read_index)
+  {
+    produced += adc_filter_push(filter, &ring[read_index], size - read_index, read_index % ADC_FILTER_CHANNELS);
+    read_index = 0;
+  }
+  produced += adc_filter_push(filter, &ring[read_index], write_index - read_index, read_index % ADC_FILTER_CHANNELS);
+  return produced;
+}
@@ -0,0 +1,22 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Número de entradas intercaladas no modo round-robin (eixo y e eixo x do joystick)
+#define ADC_FILTER_CHANNELS 2
+
+// Decimador por média (boxcar): acumula `oversample` amostras de cada canal
+// e produz um valor médio de 12 bits, reduzindo o ruído em ~sqrt(oversample).
+// Não depende do hardware, então pode ser alimentado com amostras gravadas.
+typedef struct {
+  uint16_t oversample;
+  uint32_t sum[ADC_FILTER_CHANNELS];
+  uint16_t count[ADC_FILTER_CHANNELS];
+  uint16_t output[ADC_FILTER_CHANNELS]; // Último valor decimado de cada canal
+  uint32_t outputs;                     // Quantos valores completos (todos os canais) já saíram
+} adc_filter_t;
+
+void adc_filter_init(adc_filter_t *filter, uint16_t oversample);
+uint32_t adc_filter_push(adc_filter_t *filter, const uint16_t *samples, size_t count, uint8_t first_channel);
+uint32_t adc_filter_push_ring(adc_filter_t *filter, const uint16_t *ring, size_t size, size_t read_index,
+                              size_t write_index);
@@ -0,0 +1,96 @@
+#include "adc_sampler.h"
+#include "pico/stdlib.h"
+#include "hardware/adc.h"
+#include "hardware/dma.h"
+
+// O DMA só reinicia o endereço de escrita no anel se o buffer estiver
+// alinhado ao próprio tamanho em bytes
+static uint16_t ring[ADC_SAMPLER_RING_SIZE] __attribute__((aligned(ADC_SAMPLER_RING_SIZE * sizeof(uint16_t))));
+static const uint32_t ring_transfer_count = ADC_SAMPLER_RING_SIZE;
+
+static int data_channel;
+static int control_channel;
+static uint32_t read_index;
+static adc_filter_t filter;
+static repeating_timer_t drain_timer;
+static volatile uint32_t latest; // Canal 0 nos 16 bits baixos, canal 1 nos altos (lidos juntos)
+
+static uint32_t ring_write_index(void)
+{
+  uintptr_t write_addr = dma_channel_hw_addr(data_channel)->write_addr;
+  return ((write_addr - (uintptr_t)ring) / sizeof(uint16_t)) % ADC_SAMPLER_RING_SIZE;
+}
+
+// Passa para o decimador as amostras que o DMA escreveu desde a última vez.
+// Como o anel tem tamanho par e a conversão começa na entrada 0, a posição
+// da amostra no anel indica o canal.
+static bool adc_sampler_drain(repeating_timer_t *timer)
+{
+  (void)timer;
+  uint32_t write_index = ring_write_index();
+
+  if (adc_filter_push_ring(&filter, ring, ADC_SAMPLER_RING_SIZE, read_index, write_index))
+    latest = filter.output[0] | ((uint32_t)filter.output[1] << 16);
+  read_index = write_index;
+  return true;
+}
+
+// output_rate_hz: valores decimados por segundo (por canal)
+// oversample: amostras médias por valor decimado
+void adc_sampler_init(uint32_t output_rate_hz, uint16_t oversample)
+{
+  adc_filter_init(&filter, oversample);
+
+  // Taxa total do ADC (todas as entradas). Cada conversão leva 96 ciclos do
+  // clock de 48 MHz; o divisor só acrescenta espera entre as conversões.
+  uint32_t sample_rate = output_rate_hz * filter.oversample * ADC_FILTER_CHANNELS;
+  float clkdiv = 48000000.0f / sample_rate - 1.0f;
+  adc_set_clkdiv(clkdiv < 0.0f ? 0.0f : clkdiv);
+
+  adc_select_input(0);
+  adc_set_round_robin((1u << ADC_FILTER_CHANNELS) - 1);
+  adc_fifo_setup(true, true, 1, false, false);
+  adc_fifo_drain();
+
+  // Canal de dados: FIFO do ADC -> anel, ADC_SAMPLER_RING_SIZE amostras por volta
+  data_channel = dma_claim_unused_channel(true);
+  control_channel = dma_claim_unused_channel(true);
+
+  dma_channel_config data_config = dma_channel_get_default_config(data_channel);
+  channel_config_set_transfer_data_size(&data_config, DMA_SIZE_16);
+  channel_config_set_read_increment(&data_config, false);
+  channel_config_set_write_increment(&data_config, true);
+  channel_config_set_ring(&data_config, true, ADC_SAMPLER_RING_BITS + 1);
+  channel_config_set_dreq(&data_config, DREQ_ADC);
+  channel_config_set_chain_to(&data_config, control_channel);
+  dma_channel_configure(data_channel, &data_config, ring, &adc_hw->fifo, ADC_SAMPLER_RING_SIZE, false);
+
+  // Canal de controle: ao fim de cada volta recarrega a contagem do canal de
+  // dados, o que o dispara de novo sem interrupção nem intervenção da CPU
+  dma_channel_config control_config = dma_channel_get_default_config(control_channel);
+  channel_config_set_transfer_data_size(&control_config, DMA_SIZE_32);
+  channel_config_set_read_increment(&control_config, false);
+  channel_config_set_write_increment(&control_config, false);
+  dma_channel_configure(control_channel, &control_config, &dma_hw->ch[data_channel].al1_transfer_count_trig,
+                        &ring_transfer_count, 1, false);
+
+  read_index = 0;
+  dma_channel_start(data_channel);
+  adc_run(true);
+
+  // Esvazia o anel quatro vezes a cada volta completa do DMA
+  int64_t drain_period_us = (int64_t)ADC_SAMPLER_RING_SIZE * 1000000 / sample_rate / 4;
+  add_repeating_timer_us(-(drain_period_us > 0 ? drain_period_us : 1), adc_sampler_drain, NULL, &drain_timer);
+}
+
+void adc_sampler_read(uint16_t *channel0, uint16_t *channel1)
+{
+  uint32_t value = latest;
+  *channel0 = value & 0xFFFF;
+  *channel1 = value >> 16;
+}
+
+uint32_t adc_sampler_outputs(void)
+{
+  return filter.outputs;
+}
@@ -0,0 +1,14 @@
+#include <stdint.h>
+#include "adc_filter.h"
+
+// Tamanho do buffer circular do DMA em amostras (potência de 2)
+#define ADC_SAMPLER_RING_BITS 8
+#define ADC_SAMPLER_RING_SIZE (1u << ADC_SAMPLER_RING_BITS)
+
+// Motor de amostragem do joystick: o ADC converte as entradas 0 e 1 em
+// round-robin, sem parar, e o DMA copia a FIFO para um buffer circular.
+// Um timer periódico esvazia o buffer no decimador, então a leitura não
+// depende do laço principal e não bloqueia a CPU.
+void adc_sampler_init(uint32_t output_rate_hz, uint16_t oversample);
+void adc_sampler_read(uint16_t *channel0, uint16_t *channel1);
+uint32_t adc_sampler_outputs(void);
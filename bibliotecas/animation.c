@@ -0,0 +1,105 @@
+#include "ssd1306.h"
+#include "animation.h"
+
+#define ANIMATION_HEADER_SIZE 8
+#define ANIMATION_FRAME_HEADER_SIZE 3
+#define ANIMATION_KEYFRAME 0x01
+
+static uint16_t read_u16(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8);
+}
+
+bool animation_init(animation_t *anim, const uint8_t *data)
+{
+  if (data[0] != 'A' || data[1] != 'N' || data[2] == 0 || data[3] == 0)
+    return false;
+
+  anim->data = data;
+  anim->width = data[2];
+  anim->pages = data[3];
+  anim->frame_count = read_u16(data + 4);
+  anim->interval_ms = read_u16(data + 6);
+  animation_rewind(anim);
+  return anim->frame_count > 0;
+}
+
+// Volta ao primeiro quadro (quadro-chave)
+void animation_rewind(animation_t *anim)
+{
+  anim->next = anim->data + ANIMATION_HEADER_SIZE;
+  anim->frame_index = 0;
+}
+
+// Decodifica o próximo quadro na região de anim->width colunas e anim->pages
+// páginas com canto em (x, page). Quadros-chave sobrescrevem a região; os
+// demais são XOR com o quadro anterior, e trechos de zeros (nada mudou) são
+// pulados sem tocar no buffer. Depois do último quadro volta ao primeiro.
+// Retorna se algum byte mudou; a região marcada como alterada cobre só as
+// colunas que mudaram. Um quadro cujos tokens passam do tamanho declarado é
+// decodificado só até ele.
+bool animation_next_frame(animation_t *anim, ssd1306_t *ssd, uint8_t x, uint8_t page)
+{
+  if (x + anim->width > ssd->width || page + anim->pages > ssd->pages)
+    return false;
+
+  if (anim->frame_index == anim->frame_count)
+    animation_rewind(anim);
+
+  const uint8_t *src = anim->next + ANIMATION_FRAME_HEADER_SIZE;
+  const uint8_t *end = src + read_u16(anim->next + 1);
+  bool keyframe = anim->next[0] & ANIMATION_KEYFRAME;
+  anim->next = end;
+  anim->frame_index++;
+
+  // Cursor de escrita: as páginas de uma coluna são consecutivas no
+  // ram_buffer e a próxima coluna começa ssd->pages bytes depois
+  uint8_t *column = &ssd->ram_buffer[ssd1306_index(ssd, x, page)];
+  uint32_t size = (uint32_t)anim->width * anim->pages;
+  uint32_t pos = 0;
+  uint32_t first = UINT32_MAX, last = 0;
+
+  while (src < end && pos < size)
+  {
+    uint8_t token = *src++;
+    bool run = token & 0x80;
+    uint32_t count = (token & 0x7F) + 1;
+
+    // Quadro truncado ou corrompido: nenhuma leitura passa de end
+    uint32_t available = end - src;
+    if (run && available == 0)
+      break;
+    if (!run && count > available)
+      count = available;
+    if (count > size - pos)
+      count = size - pos;
+
+    uint8_t value = run ? *src++ : 0;
+    if (run && !keyframe && value == 0)
+    {
+      pos += count; // XOR com zero: bytes iguais ao quadro anterior
+      continue;
+    }
+
+    for (uint32_t i = 0; i < count; ++i, ++pos)
+    {
+      if (!run)
+        value = *src++;
+      uint8_t *byte = column + (pos / anim->pages) * ssd->pages + pos % anim->pages;
+      uint8_t updated = keyframe ? value : (*byte ^ value);
+      if (updated != *byte)
+      {
+        *byte = updated;
+        if (pos < first)
+          first = pos;
+        last = pos;
+      }
+    }
+  }
+
+  if (first > last)
+    return false;
+  ssd1306_mark_dirty(ssd, x + first / anim->pages, page << 3, x + last / anim->pages,
+                     ((page + anim->pages) << 3) - 1);
+  return true;
+}
@@ -0,0 +1,21 @@
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct ssd1306 ssd1306_t; // bibliotecas/ssd1306.h
+
+// Reprodução das animações geradas por "Criar letras e animações via
+// priskel.py" --animacao. Os dados ficam na flash (const) e cada quadro é
+// descomprimido direto no ram_buffer, numa região alinhada a páginas.
+typedef struct {
+  const uint8_t *data; // Cabeçalho da animação
+  const uint8_t *next; // Próximo quadro a decodificar
+  uint8_t width;       // Colunas
+  uint8_t pages;       // Páginas de 8 linhas
+  uint16_t frame_count;
+  uint16_t frame_index; // Índice do próximo quadro
+  uint16_t interval_ms; // Intervalo sugerido entre quadros
+} animation_t;
+
+bool animation_init(animation_t *anim, const uint8_t *data);
+void animation_rewind(animation_t *anim);
+bool animation_next_frame(animation_t *anim, ssd1306_t *ssd, uint8_t x, uint8_t page);
@@ -0,0 +1,544 @@
+// Camadas pré-calculadas dos estilos de draw_border (128x64, mesmo layout do ram_buffer).
+// Gerado por host/gen_border_layers.c a partir de draw_border_raster; não editar à mão.
+#pragma once
+
+#include <stdint.h>
+
+#define BORDER_LAYER_STYLES 6
+#define BORDER_LAYER_SIZE (WIDTH * HEIGHT / 8)
+
+static const uint8_t border_layers[BORDER_LAYER_STYLES][BORDER_LAYER_SIZE] = {
+    { // Estilo 0
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    },
+    { // Estilo 1
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+        0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    },
+    { // Estilo 2
+        0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
+        0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
+        0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    },
+    { // Estilo 3
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    },
+    { // Estilo 4
+        0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f,
+    },
+    { // Estilo 5
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
+        0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+        0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf,
+        0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    },
+};
+
+static const uint16_t border_layer_offsets_0[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 15, 16, 23, 24, 31, 32, 39,
+    40, 47, 48, 55, 56, 63, 64, 71, 72, 79, 80, 87, 88, 95, 96, 103,
+    104, 111, 112, 119, 120, 127, 128, 135, 136, 143, 144, 151, 152, 159, 160, 167,
+    168, 175, 176, 183, 184, 191, 192, 199, 200, 207, 208, 215, 216, 223, 224, 231,
+    232, 239, 240, 247, 248, 255, 256, 263, 264, 271, 272, 279, 280, 287, 288, 295,
+    296, 303, 304, 311, 312, 319, 320, 327, 328, 335, 336, 343, 344, 351, 352, 359,
+    360, 367, 368, 375, 376, 383, 384, 391, 392, 399, 400, 407, 408, 415, 416, 423,
+    424, 431, 432, 439, 440, 447, 448, 455, 456, 463, 464, 471, 472, 479, 480, 487,
+    488, 495, 496, 503, 504, 511, 512, 519, 520, 527, 528, 535, 536, 543, 544, 551,
+    552, 559, 560, 567, 568, 575, 576, 583, 584, 591, 592, 599, 600, 607, 608, 615,
+    616, 623, 624, 631, 632, 639, 640, 647, 648, 655, 656, 663, 664, 671, 672, 679,
+    680, 687, 688, 695, 696, 703, 704, 711, 712, 719, 720, 727, 728, 735, 736, 743,
+    744, 751, 752, 759, 760, 767, 768, 775, 776, 783, 784, 791, 792, 799, 800, 807,
+    808, 815, 816, 823, 824, 831, 832, 839, 840, 847, 848, 855, 856, 863, 864, 871,
+    872, 879, 880, 887, 888, 895, 896, 903, 904, 911, 912, 919, 920, 927, 928, 935,
+    936, 943, 944, 951, 952, 959, 960, 967, 968, 975, 976, 983, 984, 991, 992, 999,
+    1000, 1007, 1008, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023,
+};
+static const uint16_t border_layer_offsets_1[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 15, 16, 23, 24, 25, 26, 27,
+    28, 29, 30, 31, 32, 39, 40, 47, 48, 55, 56, 63, 64, 71, 72, 79,
+    80, 87, 88, 95, 96, 103, 104, 111, 112, 119, 120, 127, 128, 135, 136, 143,
+    144, 151, 152, 159, 160, 167, 168, 175, 176, 183, 184, 191, 192, 199, 200, 207,
+    208, 215, 216, 223, 224, 231, 232, 239, 240, 247, 248, 255, 256, 263, 264, 271,
+    272, 279, 280, 287, 288, 295, 296, 303, 304, 311, 312, 319, 320, 327, 328, 335,
+    336, 343, 344, 351, 352, 359, 360, 367, 368, 375, 376, 383, 384, 391, 392, 399,
+    400, 407, 408, 415, 416, 423, 424, 431, 432, 439, 440, 447, 448, 455, 456, 463,
+    464, 471, 472, 479, 480, 487, 488, 495, 496, 503, 504, 511, 512, 519, 520, 527,
+    528, 535, 536, 543, 544, 551, 552, 559, 560, 567, 568, 575, 576, 583, 584, 591,
+    592, 599, 600, 607, 608, 615, 616, 623, 624, 631, 632, 639, 640, 647, 648, 655,
+    656, 663, 664, 671, 672, 679, 680, 687, 688, 695, 696, 703, 704, 711, 712, 719,
+    720, 727, 728, 735, 736, 743, 744, 751, 752, 759, 760, 767, 768, 775, 776, 783,
+    784, 791, 792, 799, 800, 807, 808, 815, 816, 823, 824, 831, 832, 839, 840, 847,
+    848, 855, 856, 863, 864, 871, 872, 879, 880, 887, 888, 895, 896, 903, 904, 911,
+    912, 919, 920, 927, 928, 935, 936, 943, 944, 951, 952, 959, 960, 967, 968, 975,
+    976, 983, 984, 991, 992, 993, 994, 995, 996, 997, 998, 999, 1000, 1007, 1008, 1015,
+    1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023,
+};
+static const uint16_t border_layer_offsets_2[] = {
+    0, 7, 8, 15, 16, 23, 24, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 47, 48, 55, 56, 63, 64, 71, 72, 79, 80, 87, 88, 95, 96, 103,
+    104, 111, 112, 119, 120, 127, 128, 135, 136, 143, 144, 151, 152, 159, 160, 167,
+    168, 175, 176, 183, 184, 191, 192, 199, 200, 207, 208, 215, 216, 223, 224, 231,
+    232, 239, 240, 247, 248, 255, 256, 263, 264, 271, 272, 279, 280, 287, 288, 295,
+    296, 303, 304, 311, 312, 319, 320, 327, 328, 335, 336, 343, 344, 351, 352, 359,
+    360, 367, 368, 375, 376, 383, 384, 391, 392, 399, 400, 407, 408, 415, 416, 423,
+    424, 431, 432, 439, 440, 447, 448, 455, 456, 463, 464, 471, 472, 479, 480, 487,
+    488, 495, 496, 503, 504, 511, 512, 519, 520, 527, 528, 535, 536, 543, 544, 551,
+    552, 559, 560, 567, 568, 575, 576, 583, 584, 591, 592, 599, 600, 607, 608, 615,
+    616, 623, 624, 631, 632, 639, 640, 647, 648, 655, 656, 663, 664, 671, 672, 679,
+    680, 687, 688, 695, 696, 703, 704, 711, 712, 719, 720, 727, 728, 735, 736, 743,
+    744, 751, 752, 759, 760, 767, 768, 775, 776, 783, 784, 791, 792, 799, 800, 807,
+    808, 815, 816, 823, 824, 831, 832, 839, 840, 847, 848, 855, 856, 863, 864, 871,
+    872, 879, 880, 887, 888, 895, 896, 903, 904, 911, 912, 919, 920, 927, 928, 935,
+    936, 943, 944, 951, 952, 959, 960, 967, 968, 975, 976, 983, 984, 985, 986, 987,
+    988, 989, 990, 991, 992, 999, 1000, 1007, 1008, 1015, 1016, 1023,
+};
+static const uint16_t border_layer_offsets_3[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 23, 24, 31, 32, 39, 40, 47, 48, 55, 56, 63, 64, 71, 72, 79,
+    80, 87, 88, 95, 96, 103, 104, 111, 112, 119, 120, 127, 128, 135, 136, 143,
+    144, 151, 152, 159, 160, 167, 168, 175, 176, 183, 184, 191, 192, 199, 200, 207,
+    208, 215, 216, 223, 224, 231, 232, 239, 240, 247, 248, 255, 256, 263, 264, 271,
+    272, 279, 280, 287, 288, 295, 296, 303, 304, 311, 312, 319, 320, 327, 328, 335,
+    336, 343, 344, 351, 352, 359, 360, 367, 368, 375, 376, 383, 384, 391, 392, 399,
+    400, 407, 408, 415, 416, 423, 424, 431, 432, 439, 440, 447, 448, 455, 456, 463,
+    464, 471, 472, 479, 480, 487, 488, 495, 496, 503, 504, 511, 512, 519, 520, 527,
+    528, 535, 536, 543, 544, 551, 552, 559, 560, 567, 568, 575, 576, 583, 584, 591,
+    592, 599, 600, 607, 608, 615, 616, 623, 624, 631, 632, 639, 640, 647, 648, 655,
+    656, 663, 664, 671, 672, 679, 680, 687, 688, 695, 696, 703, 704, 711, 712, 719,
+    720, 727, 728, 735, 736, 743, 744, 751, 752, 759, 760, 767, 768, 775, 776, 783,
+    784, 791, 792, 799, 800, 807, 808, 815, 816, 823, 824, 831, 832, 839, 840, 847,
+    848, 855, 856, 863, 864, 871, 872, 879, 880, 887, 888, 895, 896, 903, 904, 911,
+    912, 919, 920, 927, 928, 935, 936, 943, 944, 951, 952, 959, 960, 967, 968, 975,
+    976, 983, 984, 991, 992, 999, 1000, 1007, 1008, 1015, 1016, 1017, 1018, 1019, 1020, 1021,
+    1022, 1023,
+};
+static const uint16_t border_layer_offsets_4[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 15, 16, 23, 24, 31, 32, 39,
+    40, 47, 48, 55, 56, 63, 64, 71, 72, 79, 80, 87, 88, 95, 96, 103,
+    104, 111, 112, 119, 120, 127, 128, 135, 136, 143, 144, 151, 152, 159, 160, 167,
+    168, 175, 176, 183, 184, 191, 192, 199, 200, 207, 208, 215, 216, 223, 224, 231,
+    232, 239, 240, 247, 248, 255, 256, 263, 264, 271, 272, 279, 280, 287, 288, 295,
+    296, 303, 304, 311, 312, 319, 320, 327, 328, 335, 336, 343, 344, 351, 352, 359,
+    360, 367, 368, 375, 376, 383, 384, 391, 392, 399, 400, 407, 408, 415, 416, 423,
+    424, 431, 432, 439, 440, 447, 448, 455, 456, 463, 464, 471, 472, 479, 480, 487,
+    488, 495, 496, 503, 504, 511, 512, 519, 520, 527, 528, 535, 536, 543, 544, 551,
+    552, 559, 560, 567, 568, 575, 576, 583, 584, 591, 592, 599, 600, 607, 608, 615,
+    616, 623, 624, 631, 632, 639, 640, 647, 648, 655, 656, 663, 664, 671, 672, 679,
+    680, 687, 688, 695, 696, 703, 704, 711, 712, 719, 720, 727, 728, 735, 736, 743,
+    744, 751, 752, 759, 760, 767, 768, 775, 776, 783, 784, 791, 792, 799, 800, 807,
+    808, 815, 816, 823, 824, 831, 832, 839, 840, 847, 848, 855, 856, 863, 864, 871,
+    872, 879, 880, 887, 888, 895, 896, 903, 904, 911, 912, 919, 920, 927, 928, 935,
+    936, 943, 944, 951, 952, 959, 960, 967, 968, 975, 976, 983, 984, 991, 992, 999,
+    1000, 1007, 1008, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023,
+};
+static const uint16_t border_layer_offsets_5[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 47, 48, 55,
+    56, 63, 64, 71, 72, 79, 80, 87, 88, 95, 96, 103, 104, 111, 112, 119,
+    120, 127, 128, 135, 136, 143, 144, 151, 152, 159, 160, 167, 168, 175, 176, 183,
+    184, 191, 192, 199, 200, 207, 208, 215, 216, 223, 224, 231, 232, 239, 240, 247,
+    248, 255, 256, 263, 264, 271, 272, 279, 280, 287, 288, 295, 296, 303, 304, 311,
+    312, 319, 320, 327, 328, 335, 336, 343, 344, 351, 352, 359, 360, 367, 368, 375,
+    376, 383, 384, 391, 392, 399, 400, 407, 408, 415, 416, 423, 424, 431, 432, 439,
+    440, 447, 448, 455, 456, 463, 464, 471, 472, 479, 480, 487, 488, 495, 496, 503,
+    504, 511, 512, 519, 520, 527, 528, 535, 536, 543, 544, 551, 552, 559, 560, 567,
+    568, 575, 576, 583, 584, 591, 592, 599, 600, 607, 608, 615, 616, 623, 624, 631,
+    632, 639, 640, 647, 648, 655, 656, 663, 664, 671, 672, 679, 680, 687, 688, 695,
+    696, 703, 704, 711, 712, 719, 720, 727, 728, 735, 736, 743, 744, 751, 752, 759,
+    760, 767, 768, 775, 776, 783, 784, 791, 792, 799, 800, 807, 808, 815, 816, 823,
+    824, 831, 832, 839, 840, 847, 848, 855, 856, 863, 864, 871, 872, 879, 880, 887,
+    888, 895, 896, 903, 904, 911, 912, 919, 920, 927, 928, 935, 936, 943, 944, 951,
+    952, 959, 960, 967, 968, 975, 976, 983, 984, 985, 986, 987, 988, 989, 990, 991,
+    992, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1015, 1016, 1017, 1018, 1019,
+    1020, 1021, 1022, 1023,
+};
+
+static const uint16_t *const border_layer_offsets[BORDER_LAYER_STYLES] = {
+    border_layer_offsets_0,
+    border_layer_offsets_1,
+    border_layer_offsets_2,
+    border_layer_offsets_3,
+    border_layer_offsets_4,
+    border_layer_offsets_5,
+};
+
+static const uint16_t border_layer_offset_count[BORDER_LAYER_STYLES] = {
+    sizeof(border_layer_offsets_0) / sizeof(uint16_t),
+    sizeof(border_layer_offsets_1) / sizeof(uint16_t),
+    sizeof(border_layer_offsets_2) / sizeof(uint16_t),
+    sizeof(border_layer_offsets_3) / sizeof(uint16_t),
+    sizeof(border_layer_offsets_4) / sizeof(uint16_t),
+    sizeof(border_layer_offsets_5) / sizeof(uint16_t),
+};
@@ -0,0 +1,139 @@
+#include <string.h>
+#include "ssd1306.h"
+#include "fb_capture.h"
+
+void fb_capture_init(fb_capture_t *capture)
+{
+  memset(capture, 0, sizeof(*capture));
+}
+
+// O primeiro quadro depois de ligar a captura é sempre um quadro-chave
+void fb_capture_start(fb_capture_t *capture)
+{
+  capture->enabled = true;
+  capture->need_keyframe = true;
+}
+
+// Para de capturar; um quadro já codificado termina de sair pelo drain
+void fb_capture_stop(fb_capture_t *capture)
+{
+  capture->enabled = false;
+}
+
+// XOR com o quadro anterior e compressão das sequências iguais. previous
+// passa a ser o quadro atual. Retorna o tamanho da carga.
+static uint16_t fb_capture_encode(uint8_t *out, const uint8_t *frame, uint8_t *previous, uint16_t size)
+{
+  uint8_t *start = out;
+  uint16_t i = 0;
+  while (i < size)
+  {
+    uint16_t run = 0;
+    while (i + run < size && run < 128 && frame[i + run] == previous[i + run])
+      run++;
+    if (run)
+    {
+      *out++ = 0x7F + run;
+      i += run;
+      continue;
+    }
+
+    // Literais até duas posições iguais seguidas: um byte igual isolado
+    // custa menos como literal 0 do que encerrando a sequência
+    uint8_t *count = out++;
+    uint8_t n = 0;
+    while (i < size && n < 128)
+    {
+      if (frame[i] == previous[i] && (i + 1 == size || frame[i + 1] == previous[i + 1]))
+        break;
+      *out++ = frame[i] ^ previous[i];
+      previous[i] = frame[i];
+      i++;
+      n++;
+    }
+    *count = n - 1;
+  }
+  return out - start;
+}
+
+static void put_u16(uint8_t *out, uint16_t value)
+{
+  out[0] = value & 0xFF;
+  out[1] = value >> 8;
+}
+
+// Codifica o ram_buffer para envio. Retorna false se a captura está
+// desligada ou se o quadro foi descartado (envio anterior em andamento).
+bool fb_capture_frame(fb_capture_t *capture, const ssd1306_t *ssd, uint32_t timestamp_us)
+{
+  if (!capture->enabled)
+    return false;
+  if (capture->pending_offset < capture->pending_size)
+  {
+    capture->dropped++;
+    return false;
+  }
+
+  uint16_t size = ssd->width * ssd->pages;
+  if (size > FB_CAPTURE_MAX_FRAME)
+    return false;
+
+  bool keyframe = capture->need_keyframe || capture->since_keyframe >= FB_CAPTURE_KEYFRAME_INTERVAL ||
+                  ssd->width != capture->width || ssd->pages != capture->pages;
+  if (keyframe)
+  {
+    memset(capture->previous, 0, size);
+    capture->need_keyframe = false;
+    capture->since_keyframe = 0;
+    capture->width = ssd->width;
+    capture->pages = ssd->pages;
+  }
+  capture->since_keyframe++;
+
+  uint8_t *out = capture->pending;
+  uint16_t payload = fb_capture_encode(out + FB_CAPTURE_HEADER_SIZE, ssd->ram_buffer + 1, capture->previous, size);
+
+  out[0] = 'F';
+  out[1] = 'B';
+  put_u16(&out[2], capture->sequence++);
+  put_u16(&out[4], timestamp_us & 0xFFFF);
+  put_u16(&out[6], timestamp_us >> 16);
+  out[8] = ssd->width;
+  out[9] = ssd->pages;
+  out[10] = keyframe ? FB_CAPTURE_FLAG_KEYFRAME : 0;
+  put_u16(&out[11], (uint16_t)capture->dropped);
+  put_u16(&out[13], payload);
+
+  // Fletcher-16: pega bytes trocados de lugar, que um XOR simples não vê.
+  // As somas nunca passam de 2 * 254, então uma subtração faz o módulo.
+  uint16_t total = FB_CAPTURE_HEADER_SIZE + payload;
+  uint16_t sum1 = 0, sum2 = 0;
+  for (uint16_t i = 0; i < total; ++i)
+  {
+    sum1 += out[i];
+    if (sum1 >= 255)
+      sum1 -= 255;
+    sum2 += sum1;
+    if (sum2 >= 255)
+      sum2 -= 255;
+  }
+  out[total] = sum1;
+  out[total + 1] = sum2;
+
+  capture->pending_offset = 0;
+  capture->pending_size = total + 2;
+  capture->captured++;
+  return true;
+}
+
+// Envia o que a saída aceitar do quadro pendente e retorna quantos bytes
+// foram entregues
+size_t fb_capture_drain(fb_capture_t *capture, fb_capture_write_fn write, void *context)
+{
+  size_t remaining = capture->pending_size - capture->pending_offset;
+  if (!remaining)
+    return 0;
+  size_t written = write(context, &capture->pending[capture->pending_offset], remaining);
+  capture->pending_offset += written;
+  return written;
+}
@@ -0,0 +1,56 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct ssd1306 ssd1306_t; // bibliotecas/ssd1306.h
+
+// Maior quadro capturado: 128x64 (ram_buffer sem o byte de controle)
+#define FB_CAPTURE_MAX_FRAME (128 * 64 / 8)
+
+// Quadro serializado (little-endian), decodificado por host/decode_fbcapture.py:
+//   0-1   'F' 'B' (início de quadro)
+//   2-3   sequência (incrementa a cada quadro enviado)
+//   4-7   timestamp_us
+//   8     largura     9     páginas
+//   10    flags (FB_CAPTURE_FLAG_*)
+//   11-12 total de quadros descartados na placa (contador de 16 bits)
+//   13-14 tamanho da carga
+//   ...   carga: o XOR do ram_buffer com o quadro enviado antes dele (ou
+//         com zeros, num quadro-chave) em ordem de GDDRAM, comprimido em
+//         sequências: 0x00-0x7F = n + 1 bytes literais a seguir,
+//         0x80-0xFF = n - 0x7F bytes iguais ao quadro anterior
+//   2 bytes de Fletcher-16 de tudo o que vem antes
+#define FB_CAPTURE_HEADER_SIZE 15
+#define FB_CAPTURE_MAX_PAYLOAD (FB_CAPTURE_MAX_FRAME + FB_CAPTURE_MAX_FRAME / 128)
+#define FB_CAPTURE_FLAG_KEYFRAME 0x01
+
+// Um quadro-chave a cada tantos quadros, para o decodificador se recuperar
+// de bytes perdidos no caminho
+#define FB_CAPTURE_KEYFRAME_INTERVAL 50
+
+// Recebe até len bytes sem bloquear e retorna quantos aceitou
+typedef size_t (*fb_capture_write_fn)(void *context, const uint8_t *data, size_t len);
+
+// Captura do framebuffer para reprodução no PC. fb_capture_frame codifica o
+// quadro contra o último enviado (só o que mudou ocupa espaço) e
+// fb_capture_drain o entrega aos poucos, enquanto a saída aceitar bytes. Se
+// o quadro anterior ainda não saiu inteiro, o novo é descartado e o próximo
+// continua sendo codificado contra o último enviado.
+typedef struct {
+  bool enabled;
+  bool need_keyframe;
+  uint8_t width, pages; // Formato do último quadro enviado
+  uint16_t sequence;
+  uint16_t since_keyframe;
+  uint32_t captured;
+  uint32_t dropped; // Descartados com o envio anterior em andamento
+  uint8_t previous[FB_CAPTURE_MAX_FRAME];
+  uint8_t pending[FB_CAPTURE_HEADER_SIZE + FB_CAPTURE_MAX_PAYLOAD + 2];
+  uint16_t pending_offset, pending_size;
+} fb_capture_t;
+
+void fb_capture_init(fb_capture_t *capture);
+void fb_capture_start(fb_capture_t *capture);
+void fb_capture_stop(fb_capture_t *capture);
+bool fb_capture_frame(fb_capture_t *capture, const ssd1306_t *ssd, uint32_t timestamp_us);
+size_t fb_capture_drain(fb_capture_t *capture, fb_capture_write_fn write, void *context);
@@ -0,0 +1,214 @@
+// Gerado por "Criar letras e animações via priskel.py" --fonte bibliotecas/font.txt; não editar à mão.
+#include "font.h"
+
+// 191 códigos em 189 glyphs; os demais usam o espaço
+const uint8_t font_index[FONT_CODES] = {
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 0x00
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 0x10
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15, // 0x20
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31, // 0x30
+     32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47, // 0x40
+     48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63, // 0x50
+     64,  65,  66,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79, // 0x60
+     80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,  94,   0, // 0x70
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 0x80
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 0x90
+      0,  95,  96,  97,  98,  99, 100, 101, 102, 103, 104, 105, 106,  13, 107, 108, // 0xa0
+    109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, // 0xb0
+    125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, // 0xc0
+    141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, // 0xd0
+    157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, // 0xe0
+    173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, // 0xf0
+};
+
+const font_glyph_t font_glyphs[] = {
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 0, 3}, // espaço (U+0020)
+    {{0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x00}, 3, 1}, // ! (U+0021)
+    {{0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00}, 2, 3}, // " (U+0022)
+    {{0x14, 0x14, 0x7f, 0x14, 0x7f, 0x14, 0x14, 0x00}, 0, 7}, // # (U+0023)
+    {{0x24, 0x2a, 0x2a, 0x7f, 0x2a, 0x2a, 0x12, 0x00}, 0, 7}, // $ (U+0024)
+    {{0x43, 0x23, 0x10, 0x08, 0x04, 0x62, 0x61, 0x00}, 0, 7}, // % (U+0025)
+    {{0x36, 0x49, 0x49, 0x55, 0x22, 0x50, 0x00, 0x00}, 0, 6}, // & (U+0026)
+    {{0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00}, 3, 1}, // ' (U+0027)
+    {{0x00, 0x00, 0x1c, 0x22, 0x41, 0x00, 0x00, 0x00}, 2, 3}, // ( (U+0028)
+    {{0x00, 0x00, 0x41, 0x22, 0x1c, 0x00, 0x00, 0x00}, 2, 3}, // ) (U+0029)
+    {{0x08, 0x2a, 0x1c, 0x08, 0x1c, 0x2a, 0x08, 0x00}, 0, 7}, // * (U+002A)
+    {{0x08, 0x08, 0x08, 0x3e, 0x08, 0x08, 0x08, 0x00}, 0, 7}, // + (U+002B)
+    {{0x00, 0x00, 0x80, 0x60, 0x00, 0x00, 0x00, 0x00}, 2, 2}, // , (U+002C)
+    {{0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00}, 1, 5}, // - (U+002D)
+    {{0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00}, 3, 1}, // . (U+002E)
+    {{0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00}, 0, 7}, // / (U+002F)
+    {{0x3e, 0x41, 0x41, 0x49, 0x41, 0x41, 0x3e, 0x00}, 0, 7}, // 0 (U+0030)
+    {{0x00, 0x00, 0x42, 0x7f, 0x40, 0x00, 0x00, 0x00}, 2, 3}, // 1 (U+0031)
+    {{0x30, 0x49, 0x49, 0x49, 0x49, 0x46, 0x00, 0x00}, 0, 6}, // 2 (U+0032)
+    {{0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x36, 0x00}, 0, 7}, // 3 (U+0033)
+    {{0x3f, 0x20, 0x20, 0x78, 0x20, 0x20, 0x00, 0x00}, 0, 6}, // 4 (U+0034)
+    {{0x4f, 0x49, 0x49, 0x49, 0x49, 0x30, 0x00, 0x00}, 0, 6}, // 5 (U+0035)
+    {{0x3f, 0x48, 0x48, 0x48, 0x48, 0x48, 0x30, 0x00}, 0, 7}, // 6 (U+0036)
+    {{0x01, 0x01, 0x01, 0x61, 0x31, 0x0d, 0x03, 0x00}, 0, 7}, // 7 (U+0037)
+    {{0x36, 0x49, 0x49, 0x49, 0x49, 0x49, 0x36, 0x00}, 0, 7}, // 8 (U+0038)
+    {{0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x7f, 0x00}, 0, 7}, // 9 (U+0039)
+    {{0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00}, 3, 1}, // : (U+003A)
+    {{0x00, 0x00, 0x80, 0x64, 0x00, 0x00, 0x00, 0x00}, 2, 2}, // ; (U+003B)
+    {{0x00, 0x08, 0x14, 0x22, 0x41, 0x00, 0x00, 0x00}, 1, 4}, // < (U+003C)
+    {{0x00, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00}, 1, 5}, // = (U+003D)
+    {{0x00, 0x41, 0x22, 0x14, 0x08, 0x00, 0x00, 0x00}, 1, 4}, // > (U+003E)
+    {{0x02, 0x01, 0x01, 0x51, 0x09, 0x09, 0x06, 0x00}, 0, 7}, // ? (U+003F)
+    {{0x3e, 0x41, 0x5d, 0x55, 0x5d, 0x51, 0x4e, 0x00}, 0, 7}, // @ (U+0040)
+    {{0x78, 0x14, 0x12, 0x11, 0x12, 0x14, 0x78, 0x00}, 0, 7}, // A (U+0041)
+    {{0x7f, 0x49, 0x49, 0x49, 0x49, 0x49, 0x7f, 0x00}, 0, 7}, // B (U+0042)
+    {{0x7e, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x00}, 0, 7}, // C (U+0043)
+    {{0x7f, 0x41, 0x41, 0x41, 0x41, 0x41, 0x7e, 0x00}, 0, 7}, // D (U+0044)
+    {{0x7f, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00}, 0, 7}, // E (U+0045)
+    {{0x7f, 0x09, 0x09, 0x09, 0x09, 0x01, 0x01, 0x00}, 0, 7}, // F (U+0046)
+    {{0x7f, 0x41, 0x41, 0x41, 0x51, 0x51, 0x73, 0x00}, 0, 7}, // G (U+0047)
+    {{0x7f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x7f, 0x00}, 0, 7}, // H (U+0048)
+    {{0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00}, 3, 1}, // I (U+0049)
+    {{0x21, 0x41, 0x41, 0x3f, 0x01, 0x01, 0x01, 0x00}, 0, 7}, // J (U+004A)
+    {{0x00, 0x7f, 0x08, 0x08, 0x14, 0x22, 0x41, 0x00}, 1, 6}, // K (U+004B)
+    {{0x7f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00}, 0, 7}, // L (U+004C)
+    {{0x7f, 0x02, 0x04, 0x08, 0x04, 0x02, 0x7f, 0x00}, 0, 7}, // M (U+004D)
+    {{0x7f, 0x02, 0x04, 0x08, 0x10, 0x20, 0x7f, 0x00}, 0, 7}, // N (U+004E)
+    {{0x3e, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3e, 0x00}, 0, 7}, // O (U+004F)
+    {{0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00}, 0, 7}, // P (U+0050)
+    {{0x3e, 0x41, 0x41, 0x49, 0x51, 0x61, 0x7e, 0x00}, 0, 7}, // Q (U+0051)
+    {{0x7f, 0x11, 0x11, 0x11, 0x31, 0x51, 0x0e, 0x00}, 0, 7}, // R (U+0052)
+    {{0x46, 0x49, 0x49, 0x49, 0x49, 0x30, 0x00, 0x00}, 0, 6}, // S (U+0053)
+    {{0x01, 0x01, 0x01, 0x7f, 0x01, 0x01, 0x01, 0x00}, 0, 7}, // T (U+0054)
+    {{0x3f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3f, 0x00}, 0, 7}, // U (U+0055)
+    {{0x0f, 0x10, 0x20, 0x40, 0x20, 0x10, 0x0f, 0x00}, 0, 7}, // V (U+0056)
+    {{0x7f, 0x20, 0x10, 0x08, 0x10, 0x20, 0x7f, 0x00}, 0, 7}, // W (U+0057)
+    {{0x00, 0x41, 0x22, 0x14, 0x14, 0x22, 0x41, 0x00}, 1, 6}, // X (U+0058)
+    {{0x01, 0x02, 0x04, 0x78, 0x04, 0x02, 0x01, 0x00}, 0, 7}, // Y (U+0059)
+    {{0x41, 0x61, 0x59, 0x45, 0x43, 0x41, 0x00, 0x00}, 0, 6}, // Z (U+005A)
+    {{0x00, 0x00, 0x7f, 0x41, 0x41, 0x00, 0x00, 0x00}, 2, 3}, // [ (U+005B)
+    {{0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x00}, 0, 7}, // \ (U+005C)
+    {{0x00, 0x00, 0x41, 0x41, 0x7f, 0x00, 0x00, 0x00}, 2, 3}, // ] (U+005D)
+    {{0x00, 0x04, 0x02, 0x01, 0x02, 0x04, 0x00, 0x00}, 1, 5}, // ^ (U+005E)
+    {{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00}, 0, 7}, // _ (U+005F)
+    {{0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00}, 2, 2}, // ` (U+0060)
+    {{0x7c, 0xfe, 0x81, 0x81, 0xc1, 0x7e, 0xfe, 0x80}, 0, 8}, // a (U+0061)
+    {{0x7e, 0x7f, 0x88, 0x84, 0xc4, 0x78, 0x38, 0x00}, 0, 7}, // b (U+0062)
+    {{0x7c, 0x7e, 0x83, 0x81, 0xc1, 0x62, 0x22, 0x00}, 0, 7}, // c (U+0063)
+    {{0x00, 0x70, 0xc8, 0xc4, 0x84, 0x84, 0xfe, 0x7f}, 1, 7}, // d (U+0064)
+    {{0x3c, 0x7e, 0x8b, 0x89, 0xcd, 0xe7, 0x30, 0x00}, 0, 7}, // e (U+0065)
+    {{0x00, 0x04, 0x0c, 0xfe, 0xff, 0x0d, 0x0d, 0x00}, 1, 6}, // f (U+0066)
+    {{0x00, 0x8e, 0x9f, 0xd1, 0x79, 0x3f, 0x1e, 0x00}, 1, 6}, // g (U+0067)
+    {{0x00, 0xfe, 0xff, 0x10, 0x08, 0x08, 0xf8, 0xf0}, 1, 7}, // h (U+0068)
+    {{0x00, 0x00, 0x00, 0xf6, 0xfb, 0x00, 0x00, 0x00}, 3, 2}, // i (U+0069)
+    {{0x00, 0x80, 0xc0, 0xf6, 0x7b, 0x00, 0x00, 0x00}, 1, 4}, // j (U+006A)
+    {{0xfe, 0xff, 0x18, 0x24, 0xe6, 0xc2, 0x00, 0x00}, 0, 6}, // k (U+006B)
+    {{0x00, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x00}, 3, 2}, // l (U+006C)
+    {{0xfc, 0x04, 0x06, 0xfe, 0xfc, 0x02, 0x06, 0xfc}, 0, 8}, // m (U+006D)
+    {{0x00, 0xf8, 0xfc, 0x04, 0x02, 0x02, 0xfe, 0xfc}, 1, 7}, // n (U+006E)
+    {{0x78, 0x7c, 0x86, 0x82, 0x42, 0x7e, 0x3c, 0x00}, 0, 7}, // o (U+006F)
+    {{0x00, 0xfe, 0xfe, 0x21, 0x31, 0x1f, 0x1c, 0x00}, 1, 6}, // p (U+0070)
+    {{0x00, 0x1e, 0x3f, 0x21, 0x21, 0xfe, 0xfe, 0x00}, 1, 6}, // q (U+0071)
+    {{0x00, 0xf0, 0xf8, 0x0c, 0x0c, 0x08, 0x18, 0x00}, 1, 6}, // r (U+0072)
+    {{0x00, 0x00, 0x8e, 0x8b, 0xd9, 0x71, 0x00, 0x00}, 2, 4}, // s (U+0073)
+    {{0x00, 0x04, 0x04, 0xfe, 0xff, 0x06, 0x02, 0x02}, 1, 7}, // t (U+0074)
+    {{0x3f, 0x7e, 0xc0, 0x80, 0x80, 0xc0, 0x7e, 0x1f}, 0, 8}, // u (U+0075)
+    {{0x3e, 0x63, 0xc0, 0xc0, 0x30, 0x1c, 0x07, 0x00}, 0, 7}, // v (U+0076)
+    {{0x0e, 0xff, 0xe0, 0xfc, 0x3e, 0xe0, 0xf8, 0x0f}, 0, 8}, // w (U+0077)
+    {{0xc1, 0x63, 0x26, 0x3c, 0x38, 0x6c, 0xc6, 0x83}, 0, 8}, // x (U+0078)
+    {{0x0f, 0x1f, 0x18, 0x98, 0xc8, 0x7e, 0x3f, 0x00}, 0, 7}, // y (U+0079)
+    {{0xc3, 0xe3, 0xf3, 0xdb, 0xcf, 0xc7, 0xc0, 0xc0}, 0, 8}, // z (U+007A)
+    {{0x00, 0x08, 0x08, 0x36, 0x41, 0x41, 0x00, 0x00}, 1, 5}, // { (U+007B)
+    {{0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00}, 3, 1}, // | (U+007C)
+    {{0x00, 0x41, 0x41, 0x36, 0x08, 0x08, 0x00, 0x00}, 1, 5}, // } (U+007D)
+    {{0x08, 0x04, 0x04, 0x08, 0x08, 0x04, 0x00, 0x00}, 0, 6}, // ~ (U+007E)
+    {{0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x00}, 3, 1}, // ¡ (U+00A1)
+    {{0x1c, 0x22, 0x22, 0x7f, 0x22, 0x22, 0x00, 0x00}, 0, 6}, // ¢ (U+00A2)
+    {{0x48, 0x7e, 0x49, 0x49, 0x41, 0x42, 0x40, 0x00}, 0, 7}, // £ (U+00A3)
+    {{0x42, 0x3c, 0x24, 0x24, 0x24, 0x3c, 0x42, 0x00}, 0, 7}, // ¤ (U+00A4)
+    {{0x29, 0x2a, 0x2c, 0x78, 0x2c, 0x2a, 0x29, 0x00}, 0, 7}, // ¥ (U+00A5)
+    {{0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x00}, 3, 1}, // ¦ (U+00A6)
+    {{0x4a, 0x55, 0x55, 0x55, 0x29, 0x00, 0x00, 0x00}, 0, 5}, // § (U+00A7)
+    {{0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00}, 2, 3}, // ¨ (U+00A8)
+    {{0x3e, 0x41, 0x5d, 0x55, 0x55, 0x41, 0x3e, 0x00}, 0, 7}, // © (U+00A9)
+    {{0x48, 0x55, 0x55, 0x55, 0x5e, 0x00, 0x00, 0x00}, 0, 5}, // ª (U+00AA)
+    {{0x08, 0x14, 0x22, 0x08, 0x14, 0x22, 0x00, 0x00}, 0, 6}, // « (U+00AB)
+    {{0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x18, 0x00}, 0, 7}, // ¬ (U+00AC)
+    {{0x3e, 0x41, 0x7d, 0x55, 0x69, 0x41, 0x3e, 0x00}, 0, 7}, // ® (U+00AE)
+    {{0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00}, 0, 7}, // ¯ (U+00AF)
+    {{0x00, 0x06, 0x09, 0x09, 0x06, 0x00, 0x00, 0x00}, 1, 4}, // ° (U+00B0)
+    {{0x44, 0x44, 0x44, 0x5f, 0x44, 0x44, 0x44, 0x00}, 0, 7}, // ± (U+00B1)
+    {{0x00, 0x19, 0x15, 0x12, 0x00, 0x00, 0x00, 0x00}, 1, 3}, // ² (U+00B2)
+    {{0x00, 0x11, 0x15, 0x0a, 0x00, 0x00, 0x00, 0x00}, 1, 3}, // ³ (U+00B3)
+    {{0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00}, 3, 2}, // ´ (U+00B4)
+    {{0xfe, 0x10, 0x20, 0x20, 0x20, 0x10, 0x3e, 0x00}, 0, 7}, // µ (U+00B5)
+    {{0x06, 0x0f, 0x0f, 0x7f, 0x01, 0x7f, 0x01, 0x00}, 0, 7}, // ¶ (U+00B6)
+    {{0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00}, 3, 1}, // · (U+00B7)
+    {{0x00, 0x00, 0x80, 0xc0, 0x00, 0x00, 0x00, 0x00}, 2, 2}, // ¸ (U+00B8)
+    {{0x00, 0x12, 0x1f, 0x10, 0x00, 0x00, 0x00, 0x00}, 1, 3}, // ¹ (U+00B9)
+    {{0x26, 0x29, 0x29, 0x29, 0x26, 0x00, 0x00, 0x00}, 0, 5}, // º (U+00BA)
+    {{0x22, 0x14, 0x08, 0x22, 0x14, 0x08, 0x00, 0x00}, 0, 6}, // » (U+00BB)
+    {{0x42, 0x2f, 0x10, 0x48, 0x64, 0xf2, 0x41, 0x00}, 0, 7}, // ¼ (U+00BC)
+    {{0x42, 0x2f, 0x10, 0x08, 0x94, 0xd2, 0xa1, 0x00}, 0, 7}, // ½ (U+00BD)
+    {{0x51, 0x35, 0x0a, 0x48, 0x64, 0xf2, 0x41, 0x00}, 0, 7}, // ¾ (U+00BE)
+    {{0x20, 0x50, 0x48, 0x45, 0x40, 0x40, 0x20, 0x00}, 0, 7}, // ¿ (U+00BF)
+    {{0xe0, 0x50, 0x49, 0x46, 0x48, 0x50, 0xe0, 0x00}, 0, 7}, // À (U+00C0)
+    {{0xe0, 0x50, 0x48, 0x46, 0x49, 0x50, 0xe0, 0x00}, 0, 7}, // Á (U+00C1)
+    {{0xe0, 0x50, 0x4a, 0x45, 0x4a, 0x50, 0xe0, 0x00}, 0, 7}, // Â (U+00C2)
+    {{0xe0, 0x52, 0x49, 0x47, 0x4a, 0x51, 0xe0, 0x00}, 0, 7}, // Ã (U+00C3)
+    {{0xe0, 0x50, 0x4a, 0x44, 0x4a, 0x50, 0xe0, 0x00}, 0, 7}, // Ä (U+00C4)
+    {{0xe0, 0x50, 0x4b, 0x45, 0x4b, 0x50, 0xe0, 0x00}, 0, 7}, // Å (U+00C5)
+    {{0x7e, 0x09, 0x09, 0x7f, 0x49, 0x49, 0x49, 0x00}, 0, 7}, // Æ (U+00C6)
+    {{0x7e, 0x41, 0x41, 0xc1, 0xc1, 0x41, 0x41, 0x00}, 0, 7}, // Ç (U+00C7)
+    {{0xfc, 0x94, 0x95, 0x96, 0x94, 0x94, 0x94, 0x00}, 0, 7}, // È (U+00C8)
+    {{0xfc, 0x94, 0x94, 0x96, 0x95, 0x94, 0x94, 0x00}, 0, 7}, // É (U+00C9)
+    {{0xfc, 0x94, 0x96, 0x95, 0x96, 0x94, 0x94, 0x00}, 0, 7}, // Ê (U+00CA)
+    {{0xfc, 0x94, 0x96, 0x94, 0x96, 0x94, 0x94, 0x00}, 0, 7}, // Ë (U+00CB)
+    {{0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00}, 2, 2}, // Ì (U+00CC)
+    {{0x00, 0x00, 0x00, 0xfe, 0x01, 0x00, 0x00, 0x00}, 3, 2}, // Í (U+00CD)
+    {{0x00, 0x00, 0x02, 0xfd, 0x02, 0x00, 0x00, 0x00}, 2, 3}, // Î (U+00CE)
+    {{0x00, 0x00, 0x02, 0xfc, 0x02, 0x00, 0x00, 0x00}, 2, 3}, // Ï (U+00CF)
+    {{0x7f, 0x49, 0x49, 0x49, 0x41, 0x41, 0x3e, 0x00}, 0, 7}, // Ð (U+00D0)
+    {{0xfc, 0x0a, 0x11, 0x03, 0x22, 0x41, 0xfc, 0x00}, 0, 7}, // Ñ (U+00D1)
+    {{0x78, 0x84, 0x85, 0x86, 0x84, 0x84, 0x78, 0x00}, 0, 7}, // Ò (U+00D2)
+    {{0x78, 0x84, 0x84, 0x86, 0x85, 0x84, 0x78, 0x00}, 0, 7}, // Ó (U+00D3)
+    {{0x78, 0x84, 0x86, 0x85, 0x86, 0x84, 0x78, 0x00}, 0, 7}, // Ô (U+00D4)
+    {{0x78, 0x86, 0x85, 0x87, 0x86, 0x85, 0x78, 0x00}, 0, 7}, // Õ (U+00D5)
+    {{0x78, 0x84, 0x86, 0x84, 0x86, 0x84, 0x78, 0x00}, 0, 7}, // Ö (U+00D6)
+    {{0x00, 0x22, 0x14, 0x08, 0x14, 0x22, 0x00, 0x00}, 1, 5}, // × (U+00D7)
+    {{0x7e, 0x61, 0x51, 0x49, 0x45, 0x43, 0x3f, 0x00}, 0, 7}, // Ø (U+00D8)
+    {{0x7c, 0x80, 0x81, 0x82, 0x80, 0x80, 0x7c, 0x00}, 0, 7}, // Ù (U+00D9)
+    {{0x7c, 0x80, 0x80, 0x82, 0x81, 0x80, 0x7c, 0x00}, 0, 7}, // Ú (U+00DA)
+    {{0x7c, 0x80, 0x82, 0x81, 0x82, 0x80, 0x7c, 0x00}, 0, 7}, // Û (U+00DB)
+    {{0x7c, 0x80, 0x82, 0x80, 0x82, 0x80, 0x7c, 0x00}, 0, 7}, // Ü (U+00DC)
+    {{0x04, 0x08, 0x10, 0xe2, 0x11, 0x08, 0x04, 0x00}, 0, 7}, // Ý (U+00DD)
+    {{0x7f, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0c, 0x00}, 0, 7}, // Þ (U+00DE)
+    {{0xfe, 0xff, 0x01, 0x49, 0x5f, 0x76, 0x20, 0x00}, 0, 7}, // ß (U+00DF)
+    {{0x40, 0xe8, 0xa9, 0xaa, 0xa8, 0xf0, 0xf0, 0x00}, 0, 7}, // à (U+00E0)
+    {{0x40, 0xe8, 0xa8, 0xaa, 0xa9, 0xf0, 0xf0, 0x00}, 0, 7}, // á (U+00E1)
+    {{0x40, 0xe8, 0xaa, 0xa9, 0xaa, 0xf0, 0xf0, 0x00}, 0, 7}, // â (U+00E2)
+    {{0x40, 0xea, 0xa9, 0xab, 0xaa, 0xf1, 0xf0, 0x00}, 0, 7}, // ã (U+00E3)
+    {{0x40, 0xe8, 0xaa, 0xa8, 0xaa, 0xf0, 0xf0, 0x00}, 0, 7}, // ä (U+00E4)
+    {{0x40, 0xe8, 0xaf, 0xad, 0xaf, 0xf0, 0xf0, 0x00}, 0, 7}, // å (U+00E5)
+    {{0x60, 0x94, 0x94, 0x78, 0x94, 0x94, 0x58, 0x00}, 0, 7}, // æ (U+00E6)
+    {{0x38, 0x7c, 0x44, 0xc4, 0xc4, 0x64, 0x20, 0x00}, 0, 7}, // ç (U+00E7)
+    {{0x70, 0xf8, 0xa9, 0xaa, 0xa8, 0xb8, 0x30, 0x00}, 0, 7}, // è (U+00E8)
+    {{0x70, 0xf8, 0xa8, 0xaa, 0xa9, 0xb8, 0x30, 0x00}, 0, 7}, // é (U+00E9)
+    {{0x70, 0xf8, 0xaa, 0xa9, 0xaa, 0xb8, 0x30, 0x00}, 0, 7}, // ê (U+00EA)
+    {{0x70, 0xf8, 0xaa, 0xa8, 0xaa, 0xb8, 0x30, 0x00}, 0, 7}, // ë (U+00EB)
+    {{0x00, 0x00, 0x01, 0xfa, 0xf8, 0x00, 0x00, 0x00}, 2, 3}, // ì (U+00EC)
+    {{0x00, 0x00, 0x00, 0xfa, 0xf9, 0x00, 0x00, 0x00}, 3, 2}, // í (U+00ED)
+    {{0x00, 0x00, 0x02, 0xf9, 0xfa, 0x00, 0x00, 0x00}, 2, 3}, // î (U+00EE)
+    {{0x00, 0x00, 0x02, 0xf8, 0xfa, 0x00, 0x00, 0x00}, 2, 3}, // ï (U+00EF)
+    {{0x60, 0xf1, 0x95, 0x92, 0x95, 0xfc, 0x78, 0x00}, 0, 7}, // ð (U+00F0)
+    {{0xf8, 0xfa, 0x11, 0x0b, 0x0a, 0xf9, 0xf0, 0x00}, 0, 7}, // ñ (U+00F1)
+    {{0x70, 0xf8, 0x89, 0x8a, 0x88, 0xf8, 0x70, 0x00}, 0, 7}, // ò (U+00F2)
+    {{0x70, 0xf8, 0x88, 0x8a, 0x89, 0xf8, 0x70, 0x00}, 0, 7}, // ó (U+00F3)
+    {{0x70, 0xf8, 0x8a, 0x89, 0x8a, 0xf8, 0x70, 0x00}, 0, 7}, // ô (U+00F4)
+    {{0x70, 0xfa, 0x89, 0x8b, 0x8a, 0xf9, 0x70, 0x00}, 0, 7}, // õ (U+00F5)
+    {{0x70, 0xf8, 0x8a, 0x88, 0x8a, 0xf8, 0x70, 0x00}, 0, 7}, // ö (U+00F6)
+    {{0x08, 0x08, 0x08, 0x2a, 0x08, 0x08, 0x08, 0x00}, 0, 7}, // ÷ (U+00F7)
+    {{0xb8, 0x7c, 0x64, 0x54, 0x4c, 0x7c, 0x3a, 0x00}, 0, 7}, // ø (U+00F8)
+    {{0x78, 0xf8, 0x81, 0x82, 0x40, 0xf8, 0xf8, 0x00}, 0, 7}, // ù (U+00F9)
+    {{0x78, 0xf8, 0x80, 0x82, 0x41, 0xf8, 0xf8, 0x00}, 0, 7}, // ú (U+00FA)
+    {{0x78, 0xf8, 0x82, 0x81, 0x42, 0xf8, 0xf8, 0x00}, 0, 7}, // û (U+00FB)
+    {{0x78, 0xf8, 0x82, 0x80, 0x42, 0xf8, 0xf8, 0x00}, 0, 7}, // ü (U+00FC)
+    {{0x0c, 0x9c, 0x90, 0x92, 0xd1, 0x7c, 0x3c, 0x00}, 0, 7}, // ý (U+00FD)
+    {{0xff, 0xff, 0x24, 0x24, 0x24, 0x3c, 0x18, 0x00}, 0, 7}, // þ (U+00FE)
+    {{0x0c, 0x9c, 0x92, 0x90, 0xd2, 0x7c, 0x3c, 0x00}, 0, 7}, // ÿ (U+00FF)
+};
@@ -1,69 +1,24 @@
+#include <stdint.h>
 
-// Fontes para A-Z e 0-9. Os caracteres tem 8x8 pixels
+// Fonte 8x8 em Latin-1 (ISO-8859-1). Os glyphs são desenhados em font.txt e
+// font.c é gerado a partir dele pelo script do Piskel (--fonte). Tudo é
+// const, então fica na flash e existe uma vez só, seja quem for que inclua
+// este cabeçalho.
+#define FONT_CODES 256
+#define FONT_GLYPH_COLUMNS 8
+#define FONT_LINE_HEIGHT 8
+#define FONT_SPACING 1 // Coluna apagada entre glyphs no texto proporcional
 
-static uint8_t font[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // Nothing
-    0x3e, 0x41, 0x41, 0x49, 0x41, 0x41, 0x3e, 0x00, // 0
-    0x00, 0x00, 0x42, 0x7f, 0x40, 0x00, 0x00, 0x00, // 1
-    0x30, 0x49, 0x49, 0x49, 0x49, 0x46, 0x00, 0x00, // 2
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x36, 0x00, // 3
-    0x3f, 0x20, 0x20, 0x78, 0x20, 0x20, 0x00, 0x00, // 4
-    0x4f, 0x49, 0x49, 0x49, 0x49, 0x30, 0x00, 0x00, // 5
-    0x3f, 0x48, 0x48, 0x48, 0x48, 0x48, 0x30, 0x00, // 6
-    0x01, 0x01, 0x01, 0x61, 0x31, 0x0d, 0x03, 0x00, // 7
-    0x36, 0x49, 0x49, 0x49, 0x49, 0x49, 0x36, 0x00, // 8
-    0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x7f, 0x00, // 9
-    0x78, 0x14, 0x12, 0x11, 0x12, 0x14, 0x78, 0x00, // A
-    0x7f, 0x49, 0x49, 0x49, 0x49, 0x49, 0x7f, 0x00, // B
-    0x7e, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x00, // C
-    0x7f, 0x41, 0x41, 0x41, 0x41, 0x41, 0x7e, 0x00, // D
-    0x7f, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, // E
-    0x7f, 0x09, 0x09, 0x09, 0x09, 0x01, 0x01, 0x00, // F
-    0x7f, 0x41, 0x41, 0x41, 0x51, 0x51, 0x73, 0x00, // G
-    0x7f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x7f, 0x00, // H
-    0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, // I
-    0x21, 0x41, 0x41, 0x3f, 0x01, 0x01, 0x01, 0x00, // J
-    0x00, 0x7f, 0x08, 0x08, 0x14, 0x22, 0x41, 0x00, // K
-    0x7f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, // L
-    0x7f, 0x02, 0x04, 0x08, 0x04, 0x02, 0x7f, 0x00, // M
-    0x7f, 0x02, 0x04, 0x08, 0x10, 0x20, 0x7f, 0x00, // N
-    0x3e, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3e, 0x00, // O
-    0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, // P
-    0x3e, 0x41, 0x41, 0x49, 0x51, 0x61, 0x7e, 0x00, // Q
-    0x7f, 0x11, 0x11, 0x11, 0x31, 0x51, 0x0e, 0x00, // R
-    0x46, 0x49, 0x49, 0x49, 0x49, 0x30, 0x00, 0x00, // S
-    0x01, 0x01, 0x01, 0x7f, 0x01, 0x01, 0x01, 0x00, // T
-    0x3f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3f, 0x00, // U
-    0x0f, 0x10, 0x20, 0x40, 0x20, 0x10, 0x0f, 0x00, // V
-    0x7f, 0x20, 0x10, 0x08, 0x10, 0x20, 0x7f, 0x00, // W
-    0x00, 0x41, 0x22, 0x14, 0x14, 0x22, 0x41, 0x00, // X
-    0x01, 0x02, 0x04, 0x78, 0x04, 0x02, 0x01, 0x00, // Y
-    0x41, 0x61, 0x59, 0x45, 0x43, 0x41, 0x00, 0x00, // Z
-    0x7c, 0xfe, 0x81, 0x81, 0xc1, 0x7e, 0xfe, 0x80,
-    0x7e, 0x7f, 0x88, 0x84, 0xc4, 0x78, 0x38, 0x00,
-    0x7c, 0x7e, 0x83, 0x81, 0xc1, 0x62, 0x22, 0x00,
-    0x00, 0x70, 0xc8, 0xc4, 0x84, 0x84, 0xfe, 0x7f,
-    0x3c, 0x7e, 0x8b, 0x89, 0xcd, 0xe7, 0x30, 0x00,
-    0x00, 0x04, 0x0c, 0xfe, 0xff, 0x0d, 0x0d, 0x00,
-    0x00, 0x8e, 0x9f, 0xd1, 0x79, 0x3f, 0x1e, 0x00,
-    0x00, 0xfe, 0xff, 0x10, 0x08, 0x08, 0xf8, 0xf0,
-    0x00, 0x00, 0x00, 0xf6, 0xfb, 0x00, 0x00, 0x00,
-    0x00, 0x80, 0xc0, 0xf6, 0x7b, 0x00, 0x00, 0x00,
-    0xfe, 0xff, 0x18, 0x24, 0xe6, 0xc2, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x00,
-    0xfc, 0x04, 0x06, 0xfe, 0xfc, 0x02, 0x06, 0xfc,
-    0x00, 0xf8, 0xfc, 0x04, 0x02, 0x02, 0xfe, 0xfc,
-    0x78, 0x7c, 0x86, 0x82, 0x42, 0x7e, 0x3c, 0x00,
-    0x00, 0xfe, 0xfe, 0x21, 0x31, 0x1f, 0x1c, 0x00,
-    0x00, 0x1e, 0x3f, 0x21, 0x21, 0xfe, 0xfe, 0x00,
-    0x00, 0xf0, 0xf8, 0x0c, 0x0c, 0x08, 0x18, 0x00,
-    0x00, 0x00, 0x8e, 0x8b, 0xd9, 0x71, 0x00, 0x00,
-    0x00, 0x04, 0x04, 0xfe, 0xff, 0x06, 0x02, 0x02,
-    0x3f, 0x7e, 0xc0, 0x80, 0x80, 0xc0, 0x7e, 0x1f,
-    0x3e, 0x63, 0xc0, 0xc0, 0x30, 0x1c, 0x07, 0x00,
-    0x0e, 0xff, 0xe0, 0xfc, 0x3e, 0xe0, 0xf8, 0x0f,
-    0xc1, 0x63, 0x26, 0x3c, 0x38, 0x6c, 0xc6, 0x83,
-    0x0f, 0x1f, 0x18, 0x98, 0xc8, 0x7e, 0x3f, 0x00,
-    0xc3, 0xe3, 0xf3, 0xdb, 0xcf, 0xc7, 0xc0, 0xc0
+typedef struct {
+  uint8_t columns[FONT_GLYPH_COLUMNS]; // Mesmo formato dos bytes do display (bit 0 no topo)
+  uint8_t left;                        // Primeira coluna acesa
+  uint8_t width;                       // Colunas a partir de left no texto proporcional
+} font_glyph_t;
 
-};
+extern const uint8_t font_index[FONT_CODES]; // Código Latin-1 -> glyph (os sem desenho usam o espaço)
+extern const font_glyph_t font_glyphs[];
+
+static inline const font_glyph_t *font_glyph(uint8_t code)
+{
+  return &font_glyphs[font_index[code]];
+}
@@ -0,0 +1,75 @@
+#include "frame_queue.h"
+
+void frame_queue_init(frame_queue_t *queue)
+{
+  atomic_init(&queue->head, 0);
+  atomic_init(&queue->tail, 0);
+}
+
+bool frame_queue_push(frame_queue_t *queue, uint8_t frame)
+{
+  unsigned head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+  unsigned tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+  if (head - tail == FRAME_QUEUE_CAPACITY)
+    return false; // Cheia
+
+  queue->slots[head % FRAME_QUEUE_CAPACITY] = frame;
+  atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+  return true;
+}
+
+bool frame_queue_pop(frame_queue_t *queue, uint8_t *frame)
+{
+  unsigned tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+  unsigned head = atomic_load_explicit(&queue->head, memory_order_acquire);
+  if (head == tail)
+    return false; // Vazia
+
+  *frame = queue->slots[tail % FRAME_QUEUE_CAPACITY];
+  atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+  return true;
+}
+
+void frame_pipeline_init(frame_pipeline_t *pipeline, uint8_t frames)
+{
+  frame_queue_init(&pipeline->free);
+  frame_queue_init(&pipeline->ready);
+  pipeline->dropped = 0;
+  for (uint8_t frame = 0; frame < frames && frame < FRAME_PIPELINE_MAX_FRAMES; ++frame)
+    frame_queue_push(&pipeline->free, frame);
+}
+
+// Produtor: pega um quadro livre para desenhar (false se todos estão em uso)
+bool frame_pipeline_acquire(frame_pipeline_t *pipeline, uint8_t *frame)
+{
+  return frame_queue_pop(&pipeline->free, frame);
+}
+
+// Produtor: publica um quadro pronto
+void frame_pipeline_submit(frame_pipeline_t *pipeline, uint8_t frame)
+{
+  frame_queue_push(&pipeline->ready, frame);
+}
+
+// Consumidor: pega o quadro pronto mais novo, descartando os anteriores
+bool frame_pipeline_take_latest(frame_pipeline_t *pipeline, uint8_t *frame)
+{
+  uint8_t latest, newer;
+  if (!frame_queue_pop(&pipeline->ready, &latest))
+    return false;
+
+  while (frame_queue_pop(&pipeline->ready, &newer))
+  {
+    frame_queue_push(&pipeline->free, latest);
+    pipeline->dropped++;
+    latest = newer;
+  }
+  *frame = latest;
+  return true;
+}
+
+// Consumidor: devolve o quadro depois de enviado
+void frame_pipeline_release(frame_pipeline_t *pipeline, uint8_t frame)
+{
+  frame_queue_push(&pipeline->free, frame);
+}
@@ -0,0 +1,50 @@
+#include <stdint.h>
+#include <stdbool.h>
+
+// No C++ (teste com std::thread em host/) os índices são std::atomic, com o
+// mesmo tamanho e representação do atomic_uint do C
+#ifdef __cplusplus
+#include <atomic>
+typedef std::atomic<unsigned> frame_queue_index_t;
+extern "C" {
+#else
+#include <stdatomic.h>
+typedef atomic_uint frame_queue_index_t;
+#endif
+
+// Capacidade de cada fila (potência de 2, maior que o número de quadros)
+#define FRAME_QUEUE_CAPACITY 4
+#define FRAME_PIPELINE_MAX_FRAMES FRAME_QUEUE_CAPACITY
+
+// Fila lock-free de um produtor e um consumidor com índices de quadro.
+// head só é escrito pelo produtor e tail só pelo consumidor, então basta
+// load/store com acquire/release (o Cortex-M0+ não tem LDREX/STREX).
+typedef struct {
+  uint8_t slots[FRAME_QUEUE_CAPACITY];
+  frame_queue_index_t head;
+  frame_queue_index_t tail;
+} frame_queue_t;
+
+// Pipeline de quadros entre quem desenha (produtor) e quem envia (consumidor).
+// Os quadros circulam entre a fila de livres e a de prontos; quando o desenho
+// é mais rápido que o envio, o consumidor pega só o quadro mais novo e
+// devolve os antigos, contando-os em dropped.
+typedef struct {
+  frame_queue_t free;  // Consumidor -> produtor
+  frame_queue_t ready; // Produtor -> consumidor
+  uint32_t dropped;    // Escrito apenas pelo consumidor
+} frame_pipeline_t;
+
+void frame_queue_init(frame_queue_t *queue);
+bool frame_queue_push(frame_queue_t *queue, uint8_t frame);
+bool frame_queue_pop(frame_queue_t *queue, uint8_t *frame);
+
+void frame_pipeline_init(frame_pipeline_t *pipeline, uint8_t frames);
+bool frame_pipeline_acquire(frame_pipeline_t *pipeline, uint8_t *frame);
+void frame_pipeline_submit(frame_pipeline_t *pipeline, uint8_t frame);
+bool frame_pipeline_take_latest(frame_pipeline_t *pipeline, uint8_t *frame);
+void frame_pipeline_release(frame_pipeline_t *pipeline, uint8_t frame);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,30 @@
+#include "frame_scheduler.h"
+
+void frame_scheduler_init(frame_scheduler_t *scheduler, uint32_t period_us)
+{
+  scheduler->period_us = period_us;
+  scheduler->frames = 0;
+  scheduler->missed = 0;
+  scheduler->deadline = make_timeout_time_us(period_us);
+}
+
+// Dorme (WFE) até o prazo do quadro atual e calcula o do próximo. Se o prazo
+// já passou o quadro conta como perdido; atrasos maiores que um período
+// reiniciam a grade em vez de emendar vários quadros sem espera.
+void frame_scheduler_wait(frame_scheduler_t *scheduler)
+{
+  scheduler->frames++;
+  if (time_reached(scheduler->deadline))
+  {
+    scheduler->missed++;
+    absolute_time_t now = get_absolute_time();
+    if (absolute_time_diff_us(scheduler->deadline, now) > scheduler->period_us)
+      scheduler->deadline = now;
+  }
+  else
+  {
+    while (!best_effort_wfe_or_timeout(scheduler->deadline))
+      tight_loop_contents();
+  }
+  scheduler->deadline = delayed_by_us(scheduler->deadline, scheduler->period_us);
+}
@@ -0,0 +1,15 @@
+#include <stdint.h>
+#include "pico/stdlib.h"
+
+// Agenda os quadros por prazos absolutos (deadline anterior + período), de
+// forma que o tempo de desenho e envio não se acumule sobre o período como
+// acontecia com sleep_ms depois do trabalho
+typedef struct {
+  absolute_time_t deadline;
+  uint32_t period_us;
+  uint32_t frames;
+  uint32_t missed; // Quadros que terminaram depois do próprio prazo
+} frame_scheduler_t;
+
+void frame_scheduler_init(frame_scheduler_t *scheduler, uint32_t period_us);
+void frame_scheduler_wait(frame_scheduler_t *scheduler);
@@ -0,0 +1,58 @@
+#include <stdio.h>
+#include <string.h>
+#include "frame_stats.h"
+
+void frame_histogram_init(frame_histogram_t *histogram, const char *name)
+{
+  memset(histogram, 0, sizeof(*histogram));
+  histogram->name = name;
+  histogram->min_us = UINT32_MAX;
+}
+
+void frame_histogram_add(frame_histogram_t *histogram, uint32_t us)
+{
+  uint32_t bucket = us / FRAME_STATS_BUCKET_US;
+  histogram->buckets[bucket < FRAME_STATS_BUCKETS ? bucket : FRAME_STATS_BUCKETS - 1]++;
+  histogram->count++;
+  histogram->total_us += us;
+  if (us < histogram->min_us)
+    histogram->min_us = us;
+  if (us > histogram->max_us)
+    histogram->max_us = us;
+}
+
+uint32_t frame_histogram_average(const frame_histogram_t *histogram)
+{
+  return histogram->count ? histogram->total_us / histogram->count : 0;
+}
+
+// Limite superior do balde onde o percentil cai (limitado ao máximo observado)
+uint32_t frame_histogram_percentile(const frame_histogram_t *histogram, uint8_t percent)
+{
+  if (!histogram->count)
+    return 0;
+
+  uint32_t target = ((uint64_t)histogram->count * percent + 99) / 100;
+  uint32_t seen = 0;
+  for (uint32_t bucket = 0; bucket < FRAME_STATS_BUCKETS; ++bucket)
+  {
+    seen += histogram->buckets[bucket];
+    if (seen >= target)
+    {
+      uint32_t upper = (bucket + 1) * FRAME_STATS_BUCKET_US;
+      return upper < histogram->max_us ? upper : histogram->max_us;
+    }
+  }
+  return histogram->max_us;
+}
+
+void frame_histogram_print(const frame_histogram_t *histogram)
+{
+  printf("%-10s n=%-7lu min=%-6lu avg=%-6lu p99=%-6lu max=%lu us\n",
+         histogram->name,
+         (unsigned long)histogram->count,
+         (unsigned long)(histogram->count ? histogram->min_us : 0),
+         (unsigned long)frame_histogram_average(histogram),
+         (unsigned long)frame_histogram_percentile(histogram, 99),
+         (unsigned long)histogram->max_us);
+}
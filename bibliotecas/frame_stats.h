@@ -0,0 +1,21 @@
+#include <stdint.h>
+
+// Histograma de tempos em microssegundos com baldes de largura fixa; tempos
+// acima do último balde caem nele (o máximo exato fica em max_us)
+#define FRAME_STATS_BUCKETS 128
+#define FRAME_STATS_BUCKET_US 250
+
+typedef struct {
+  const char *name;
+  uint32_t count;
+  uint32_t min_us;
+  uint32_t max_us;
+  uint64_t total_us;
+  uint32_t buckets[FRAME_STATS_BUCKETS];
+} frame_histogram_t;
+
+void frame_histogram_init(frame_histogram_t *histogram, const char *name);
+void frame_histogram_add(frame_histogram_t *histogram, uint32_t us);
+uint32_t frame_histogram_average(const frame_histogram_t *histogram);
+uint32_t frame_histogram_percentile(const frame_histogram_t *histogram, uint8_t percent);
+void frame_histogram_print(const frame_histogram_t *histogram);
@@ -0,0 +1,87 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include "ssd1306.h"
+#include "hud.h"
+
+void hud_field_init(hud_field_t *field, uint8_t x, uint8_t y, uint8_t cells)
+{
+  field->x = x;
+  field->y = y;
+  field->cells = cells < HUD_FIELD_MAX_CELLS ? cells : HUD_FIELD_MAX_CELLS;
+  hud_field_invalidate(field);
+}
+
+static void hud_field_clear_damage(hud_field_t *field)
+{
+  field->damage_x0 = 0xFF;
+  field->damage_x1 = 0;
+}
+
+// Escreve o texto no campo, completando com espaços (o excedente é cortado).
+// As células redesenhadas entram na região do campo, não na região alterada
+// do display. Retorna quantas células foram redesenhadas.
+uint8_t hud_field_set(ssd1306_t *ssd, hud_field_t *field, const char *text)
+{
+  uint8_t redrawn = 0;
+  for (uint8_t i = 0; i < field->cells; ++i)
+  {
+    char c = *text ? *text++ : ' ';
+    if (c == field->shown[i])
+      continue;
+
+    uint16_t x = field->x + i * 8;
+    if (x >= ssd->width)
+      break;
+    bool changed = ssd1306_blit_char(ssd, c, x, field->y);
+    field->shown[i] = c;
+    redrawn++;
+    if (!changed)
+      continue;
+
+    uint8_t x1 = x + 7 < ssd->width ? x + 7 : ssd->width - 1;
+    if (x < field->damage_x0)
+      field->damage_x0 = x;
+    if (x1 > field->damage_x1)
+      field->damage_x1 = x1;
+  }
+  return redrawn;
+}
+
+uint8_t hud_field_printf(ssd1306_t *ssd, hud_field_t *field, const char *format, ...)
+{
+  char text[HUD_FIELD_MAX_CELLS + 1];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(text, sizeof(text), format, args);
+  va_end(args);
+  return hud_field_set(ssd, field, text);
+}
+
+// Esquece o conteúdo desenhado, forçando o próximo hud_field_set a redesenhar
+// todas as células. Usado quando o quadro sob o campo foi substituído (ex.:
+// troca de borda por draw_border_copy) ou num buffer que não guarda o
+// quadro anterior.
+void hud_field_invalidate(hud_field_t *field)
+{
+  memset(field->shown, 0, sizeof(field->shown));
+  hud_field_clear_damage(field);
+}
+
+// Envia as colunas do campo redesenhadas desde o último envio, bloqueando.
+// Espera antes um envio assíncrono em andamento. O bloqueio é aceitável:
+// chamado logo depois de ssd1306_wait_flush, o barramento está livre; a
+// janela tem no máximo 16 células numa ou duas páginas (até ~260 bytes, em
+// geral uma ou duas células, ~0,3 ms a 400 kHz) e o DMA da região alterada,
+// no mesmo barramento, teria de esperar por ela de qualquer jeito. O custo é
+// só a CPU parada esse tempo. Pôr as janelas na fila assíncrona exigiria
+// mais de uma janela por envio no transporte, que hoje leva uma só.
+void hud_field_flush(ssd1306_t *ssd, hud_field_t *field)
+{
+  if (field->damage_x0 > field->damage_x1)
+    return;
+  uint8_t page0 = field->y / 8;
+  uint8_t page1 = (field->y + 7) / 8 < ssd->pages ? (field->y + 7) / 8 : ssd->pages - 1;
+  ssd1306_send_window(ssd, field->damage_x0, field->damage_x1, page0, page1);
+  hud_field_clear_damage(field);
+}
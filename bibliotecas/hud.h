@@ -0,0 +1,26 @@
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct ssd1306 ssd1306_t; // bibliotecas/ssd1306.h
+
+#define HUD_FIELD_MAX_CELLS 16 // Uma linha inteira de 128 colunas
+
+// Campo de texto de largura fixa, em células de 8x8 da fonte. Guarda o texto
+// já desenhado e, a cada atualização, só copia os glifos das células cujo
+// caractere mudou. Essas células ficam numa região própria do campo, enviada
+// por hud_field_flush, e não na região alterada do display: campos em cima e
+// embaixo da tela, somados ao que mais mudou no quadro, virariam um envio de
+// quase a tela inteira. Um contador de quatro dígitos custa no máximo alguns
+// glifos por quadro, em vez da linha inteira de ssd1306_draw_string.
+typedef struct {
+  uint8_t x, y;                    // Canto superior esquerdo, em pixels
+  uint8_t cells;                   // Largura em caracteres
+  char shown[HUD_FIELD_MAX_CELLS]; // Conteúdo de cada célula ('\0' = desconhecido)
+  uint8_t damage_x0, damage_x1;    // Colunas redesenhadas e ainda não enviadas (vazia se x0 > x1)
+} hud_field_t;
+
+void hud_field_init(hud_field_t *field, uint8_t x, uint8_t y, uint8_t cells);
+uint8_t hud_field_set(ssd1306_t *ssd, hud_field_t *field, const char *text);
+uint8_t hud_field_printf(ssd1306_t *ssd, hud_field_t *field, const char *format, ...);
+void hud_field_invalidate(hud_field_t *field);
+void hud_field_flush(ssd1306_t *ssd, hud_field_t *field);
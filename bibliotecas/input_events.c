@@ -0,0 +1,128 @@
+#include <string.h>
+#include "input_events.h"
+
+void input_events_init(input_events_t *input, uint32_t debounce_us)
+{
+  memset(input, 0, sizeof(*input));
+  atomic_init(&input->head, 0);
+  atomic_init(&input->tail, 0);
+  input->debounce_us = debounce_us;
+}
+
+// Registra um pino com o estado inicial lido antes de habilitar a interrupção
+bool input_events_add_pin(input_events_t *input, uint8_t gpio, bool pressed)
+{
+  if (input->pin_count == INPUT_MAX_PINS)
+    return false;
+
+  input_pin_t *pin = &input->pins[input->pin_count++];
+  pin->gpio = gpio;
+  pin->pressed = pressed;
+  pin->raw_pressed = pressed;
+  pin->settling = false;
+  pin->last_change_us = 0;
+  pin->last_edge_us = 0;
+  return true;
+}
+
+// Chamado na interrupção: só grava a borda na fila
+void input_events_push_edge(input_events_t *input, uint8_t gpio, bool level, uint32_t timestamp_us)
+{
+  unsigned head = atomic_load_explicit(&input->head, memory_order_relaxed);
+  unsigned tail = atomic_load_explicit(&input->tail, memory_order_acquire);
+  if (head - tail == INPUT_EDGE_CAPACITY)
+  {
+    input->overflows++;
+    return;
+  }
+
+  input_edge_t *edge = &input->edges[head % INPUT_EDGE_CAPACITY];
+  edge->timestamp_us = timestamp_us;
+  edge->gpio = gpio;
+  edge->level = level;
+  atomic_store_explicit(&input->head, head + 1, memory_order_release);
+}
+
+static input_pin_t *input_find_pin(input_events_t *input, uint8_t gpio)
+{
+  for (uint8_t i = 0; i < input->pin_count; ++i)
+  {
+    if (input->pins[i].gpio == gpio)
+      return &input->pins[i];
+  }
+  return NULL;
+}
+
+// Aplica o nível cru ao estado filtrado e abre uma janela de debounce em at_us
+static void input_pin_change(input_pin_t *pin, uint32_t at_us, input_event_t *event)
+{
+  pin->pressed = pin->raw_pressed;
+  pin->settling = true;
+  pin->last_change_us = at_us;
+  event->timestamp_us = at_us;
+  event->gpio = pin->gpio;
+  event->pressed = pin->pressed;
+}
+
+// Fecha as janelas de debounce terminadas até at_us. Se o nível cru mudou
+// dentro de uma delas (toque mais curto que a janela), o evento pendente sai
+// com o instante do fim da janela; havendo vários, o da janela que terminou
+// primeiro.
+static bool input_settle_pins(input_events_t *input, uint32_t at_us, input_event_t *event)
+{
+  input_pin_t *first = NULL;
+  for (uint8_t i = 0; i < input->pin_count; ++i)
+  {
+    input_pin_t *pin = &input->pins[i];
+    if (!pin->settling || at_us - pin->last_change_us < input->debounce_us)
+      continue;
+    if (pin->raw_pressed == pin->pressed)
+      pin->settling = false;
+    else if (!first || pin->last_change_us - first->last_change_us > UINT32_MAX / 2)
+      first = pin;
+  }
+  if (!first)
+    return false;
+
+  input_pin_change(first, first->last_change_us + input->debounce_us, event);
+  return true;
+}
+
+// Consome as bordas pendentes e devolve até max_events eventos filtrados, em
+// ordem. Chamado uma vez por quadro; now_us também resolve toques curtos.
+size_t input_events_poll(input_events_t *input, uint32_t now_us, input_event_t *events, size_t max_events)
+{
+  size_t count = 0;
+
+  while (count < max_events)
+  {
+    unsigned tail = atomic_load_explicit(&input->tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&input->head, memory_order_acquire);
+    if (head == tail)
+      break;
+
+    input_edge_t edge = input->edges[tail % INPUT_EDGE_CAPACITY];
+
+    // Janelas que terminaram antes desta borda: os eventos pendentes delas
+    // saem primeiro, em ordem de tempo, e a borda é vista de novo na próxima volta
+    if (input_settle_pins(input, edge.timestamp_us, &events[count]))
+    {
+      count++;
+      continue;
+    }
+    atomic_store_explicit(&input->tail, tail + 1, memory_order_release);
+
+    input_pin_t *pin = input_find_pin(input, edge.gpio);
+    if (!pin)
+      continue;
+
+    pin->raw_pressed = !edge.level;
+    pin->last_edge_us = edge.timestamp_us;
+    if (!pin->settling && pin->raw_pressed != pin->pressed)
+      input_pin_change(pin, edge.timestamp_us, &events[count++]);
+  }
+
+  while (count < max_events && input_settle_pins(input, now_us, &events[count]))
+    count++;
+  return count;
+}
@@ -0,0 +1,52 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdatomic.h>
+
+#define INPUT_EDGE_CAPACITY 32 // Bordas pendentes entre a interrupção e o laço (potência de 2)
+#define INPUT_MAX_PINS 4
+
+// Borda crua registrada pela interrupção
+typedef struct {
+  uint32_t timestamp_us;
+  uint8_t gpio;
+  bool level; // Nível do pino lido na interrupção
+} input_edge_t;
+
+// Evento já filtrado entregue ao laço principal
+typedef struct {
+  uint32_t timestamp_us; // Instante da borda que originou o evento
+  uint8_t gpio;
+  bool pressed;
+} input_event_t;
+
+// Máquina de debounce de um pino (botões com pull-up: nível baixo = pressionado).
+// A primeira borda é aceita na hora e as seguintes são ignoradas durante
+// debounce_us; se ao fim da janela o nível cru for diferente do estado
+// filtrado (toque mais curto que a janela), o estado é corrigido com um evento
+// no instante do fim da janela, mesmo que a próxima borda só chegue depois.
+typedef struct {
+  uint8_t gpio;
+  bool pressed;              // Estado filtrado
+  bool raw_pressed;          // Último nível visto nas bordas
+  bool settling;             // Dentro da janela de debounce desde last_change_us
+  uint32_t last_change_us;   // Última mudança do estado filtrado
+  uint32_t last_edge_us;     // Última borda crua
+} input_pin_t;
+
+// A interrupção só chama input_events_push_edge; o debounce e a geração de
+// eventos rodam em input_events_poll, no laço principal
+typedef struct {
+  input_edge_t edges[INPUT_EDGE_CAPACITY];
+  atomic_uint head;
+  atomic_uint tail;
+  uint32_t overflows; // Bordas perdidas com a fila cheia
+  input_pin_t pins[INPUT_MAX_PINS];
+  uint8_t pin_count;
+  uint32_t debounce_us;
+} input_events_t;
+
+void input_events_init(input_events_t *input, uint32_t debounce_us);
+bool input_events_add_pin(input_events_t *input, uint8_t gpio, bool pressed);
+void input_events_push_edge(input_events_t *input, uint8_t gpio, bool level, uint32_t timestamp_us);
+size_t input_events_poll(input_events_t *input, uint32_t now_us, input_event_t *events, size_t max_events);
@@ -0,0 +1,202 @@
+#include <string.h>
+#include "joystick_cal.h"
+
+static const joystick_axis_cal_t default_axis = {.min = 0, .center = 2048, .max = 4095, .deadzone = 100};
+
+// span_x/span_y: maior posição do quadrado em cada eixo (largura/altura da
+// tela menos o tamanho do quadrado)
+void joystick_cal_init(joystick_cal_t *cal, uint8_t span_x, uint8_t span_y)
+{
+  memset(cal, 0, sizeof(*cal));
+  cal->span[0] = span_x;
+  cal->span[1] = span_y;
+  for (int axis = 0; axis < JOYSTICK_CAL_AXES; ++axis)
+    cal->axis[axis] = default_axis;
+  joystick_cal_build(cal);
+}
+
+// Divisão com arredondamento para o inteiro mais próximo (denominador > 0)
+static int32_t div_round(int32_t numerator, int32_t denominator)
+{
+  return (numerator >= 0) ? (numerator + denominator / 2) / denominator : (numerator - denominator / 2) / denominator;
+}
+
+// Cada metade do curso (mínimo-centro e centro-máximo) é mapeada
+// separadamente, então um centro deslocado ainda leva às duas bordas
+static void build_axis(joystick_cal_t *cal, int axis)
+{
+  const joystick_axis_cal_t *a = &cal->axis[axis];
+  int32_t span = cal->span[axis];
+  int32_t half_low = span / 2;
+  int32_t half_high = span - half_low;
+
+  for (uint32_t i = 0; i < JOYSTICK_CAL_LUT_SIZE; ++i)
+  {
+    // Leitura da faixa desta entrada mais distante do centro, para que as
+    // entradas das pontas cheguem às bordas e ao brilho máximo
+    int32_t value = (int32_t)(i << JOYSTICK_CAL_LUT_SHIFT);
+    if (value >= a->center)
+      value += (1 << JOYSTICK_CAL_LUT_SHIFT) - 1;
+    int32_t offset = value - a->center;
+    int32_t range = (offset < 0) ? a->center - a->min : a->max - a->center;
+    if (range < 1)
+      range = 1;
+
+    int32_t position = half_low + div_round(offset * ((offset < 0) ? half_low : half_high), range);
+    if (position < 0)
+      position = 0;
+    if (position > span)
+      position = span;
+    // Na tela Y cresce para baixo; no joystick, para cima
+    cal->screen[axis][i] = (axis == 1) ? span - position : position;
+
+    int32_t distance = (offset < 0) ? -offset : offset;
+    int32_t brightness = 0;
+    if (distance > a->deadzone)
+    {
+      int32_t travel = range - a->deadzone;
+      brightness = (travel > 0) ? (distance - a->deadzone) * JOYSTICK_CAL_BRIGHTNESS_MAX / travel : 0;
+      if (brightness > JOYSTICK_CAL_BRIGHTNESS_MAX)
+        brightness = JOYSTICK_CAL_BRIGHTNESS_MAX;
+    }
+    cal->brightness[axis][i] = brightness;
+  }
+}
+
+void joystick_cal_build(joystick_cal_t *cal)
+{
+  for (int axis = 0; axis < JOYSTICK_CAL_AXES; ++axis)
+    build_axis(cal, axis);
+}
+
+// full = false: só o centro e a zona morta (joystick parado, como no boot);
+// full = true: em seguida também o mínimo e o máximo
+void joystick_cal_start(joystick_cal_t *cal, bool full, uint32_t now_us)
+{
+  cal->phase = JOYSTICK_CAL_CENTER;
+  cal->full = full;
+  cal->phase_start_us = now_us;
+  cal->samples = 0;
+  for (int axis = 0; axis < JOYSTICK_CAL_AXES; ++axis)
+  {
+    cal->sum[axis] = 0;
+    cal->seen_min[axis] = 0xFFFF;
+    cal->seen_max[axis] = 0;
+  }
+}
+
+static void finish_center(joystick_cal_t *cal)
+{
+  for (int axis = 0; axis < JOYSTICK_CAL_AXES; ++axis)
+  {
+    joystick_axis_cal_t *a = &cal->axis[axis];
+    a->center = cal->sum[axis] / cal->samples;
+
+    // Zona morta: o dobro do maior desvio visto com o joystick parado
+    uint16_t below = a->center - cal->seen_min[axis];
+    uint16_t above = cal->seen_max[axis] - a->center;
+    uint16_t deadzone = 2 * ((below > above) ? below : above);
+    if (deadzone < JOYSTICK_CAL_MIN_DEADZONE)
+      deadzone = JOYSTICK_CAL_MIN_DEADZONE;
+    if (deadzone > JOYSTICK_CAL_MAX_DEADZONE)
+      deadzone = JOYSTICK_CAL_MAX_DEADZONE; // Joystick mexido durante a fase
+    a->deadzone = deadzone;
+
+    // O centro não pode ficar fora do curso conhecido
+    if (a->min >= a->center)
+      a->min = default_axis.min;
+    if (a->max <= a->center)
+      a->max = default_axis.max;
+  }
+}
+
+static void finish_range(joystick_cal_t *cal)
+{
+  for (int axis = 0; axis < JOYSTICK_CAL_AXES; ++axis)
+  {
+    joystick_axis_cal_t *a = &cal->axis[axis];
+    // Lado que não foi até o batente mantém o valor anterior
+    if (cal->seen_min[axis] + JOYSTICK_CAL_MIN_TRAVEL <= a->center)
+      a->min = cal->seen_min[axis];
+    if (cal->seen_max[axis] >= a->center + JOYSTICK_CAL_MIN_TRAVEL)
+      a->max = cal->seen_max[axis];
+  }
+}
+
+// Alimenta o aprendizado com uma leitura por quadro. Retorna true quando a
+// calibração termina e as tabelas já foram refeitas.
+bool joystick_cal_feed(joystick_cal_t *cal, uint16_t x, uint16_t y, uint32_t now_us)
+{
+  if (cal->phase == JOYSTICK_CAL_IDLE)
+    return false;
+
+  uint32_t elapsed = now_us - cal->phase_start_us;
+  if (cal->phase == JOYSTICK_CAL_CENTER && elapsed >= JOYSTICK_CAL_CENTER_US && cal->samples > 0)
+  {
+    finish_center(cal);
+    if (cal->full)
+    {
+      joystick_cal_start(cal, true, now_us);
+      cal->phase = JOYSTICK_CAL_RANGE;
+      return false;
+    }
+  }
+  else if (cal->phase == JOYSTICK_CAL_RANGE && elapsed >= JOYSTICK_CAL_RANGE_US)
+  {
+    finish_range(cal);
+  }
+  else
+  {
+    // Fase em andamento: a leitura entra na média e nos extremos
+    const uint16_t values[JOYSTICK_CAL_AXES] = {x, y};
+    for (int axis = 0; axis < JOYSTICK_CAL_AXES; ++axis)
+    {
+      cal->sum[axis] += values[axis];
+      if (values[axis] < cal->seen_min[axis])
+        cal->seen_min[axis] = values[axis];
+      if (values[axis] > cal->seen_max[axis])
+        cal->seen_max[axis] = values[axis];
+    }
+    cal->samples++;
+    return false;
+  }
+
+  cal->phase = JOYSTICK_CAL_IDLE;
+  joystick_cal_build(cal);
+  return true;
+}
+
+static uint32_t record_checksum(const joystick_cal_record_t *record)
+{
+  const uint8_t *bytes = (const uint8_t *)record->axis;
+  uint32_t checksum = record->magic;
+  for (size_t i = 0; i < sizeof(record->axis); ++i)
+    checksum = ((checksum << 5) | (checksum >> 27)) ^ bytes[i];
+  return checksum;
+}
+
+void joystick_cal_export(const joystick_cal_t *cal, joystick_cal_record_t *record)
+{
+  memset(record, 0, sizeof(*record));
+  record->magic = JOYSTICK_CAL_MAGIC;
+  memcpy(record->axis, cal->axis, sizeof(record->axis));
+  record->checksum = record_checksum(record);
+}
+
+// Aceita só registros íntegros e coerentes (flash apagada ou de outra versão
+// é ignorada) e refaz as tabelas
+bool joystick_cal_import(joystick_cal_t *cal, const joystick_cal_record_t *record)
+{
+  if (record->magic != JOYSTICK_CAL_MAGIC || record->checksum != record_checksum(record))
+    return false;
+  for (int axis = 0; axis < JOYSTICK_CAL_AXES; ++axis)
+  {
+    const joystick_axis_cal_t *a = &record->axis[axis];
+    if (a->min >= a->center || a->center >= a->max || a->max > 4095)
+      return false;
+  }
+
+  memcpy(cal->axis, record->axis, sizeof(cal->axis));
+  joystick_cal_build(cal);
+  return true;
+}
@@ -0,0 +1,78 @@
+#include <stdint.h>
+#include <stdbool.h>
+
+// Tabelas indexadas pelos 10 bits altos da leitura de 12 bits do ADC
+#define JOYSTICK_CAL_LUT_BITS 10
+#define JOYSTICK_CAL_LUT_SIZE (1u << JOYSTICK_CAL_LUT_BITS)
+#define JOYSTICK_CAL_LUT_SHIFT (12 - JOYSTICK_CAL_LUT_BITS)
+
+#define JOYSTICK_CAL_AXES 2 // 0 = X, 1 = Y
+#define JOYSTICK_CAL_BRIGHTNESS_MAX 4095
+
+// Duração das fases: com o joystick parado (centro e ruído) e girando-o até
+// os batentes (mínimo e máximo)
+#define JOYSTICK_CAL_CENTER_US 1000000
+#define JOYSTICK_CAL_RANGE_US 4000000
+
+#define JOYSTICK_CAL_MIN_DEADZONE 48 // Zona morta em torno do centro, em contagens do ADC
+#define JOYSTICK_CAL_MAX_DEADZONE 400
+#define JOYSTICK_CAL_MIN_TRAVEL 512  // Curso mínimo de cada lado para aceitar o mínimo/máximo aprendido
+
+typedef struct {
+  uint16_t min, center, max;
+  uint16_t deadzone; // Afastamento do centro que ainda conta como parado
+} joystick_axis_cal_t;
+
+// Formato gravado na flash
+#define JOYSTICK_CAL_MAGIC 0x4A43414Cu // "JCAL"
+typedef struct {
+  uint32_t magic;
+  joystick_axis_cal_t axis[JOYSTICK_CAL_AXES];
+  uint32_t checksum;
+} joystick_cal_record_t;
+
+typedef enum {
+  JOYSTICK_CAL_IDLE,
+  JOYSTICK_CAL_CENTER, // Média e ruído com o joystick parado
+  JOYSTICK_CAL_RANGE,  // Mínimo e máximo com o joystick girando
+} joystick_cal_phase_t;
+
+// Calibração do joystick e as tabelas geradas a partir dela: a posição do
+// quadrado e o brilho dos LEDs saem de uma leitura de tabela por eixo, sem
+// divisão e já descontando centro, curso e zona morta do joystick real.
+// Independe do hardware; a gravação na flash fica em joystick_cal_flash.c.
+typedef struct {
+  joystick_axis_cal_t axis[JOYSTICK_CAL_AXES];
+  uint8_t span[JOYSTICK_CAL_AXES];                               // Maior posição do quadrado em cada eixo
+  uint8_t screen[JOYSTICK_CAL_AXES][JOYSTICK_CAL_LUT_SIZE];      // Posição na tela (Y invertido)
+  uint16_t brightness[JOYSTICK_CAL_AXES][JOYSTICK_CAL_LUT_SIZE]; // Brilho linear dos LEDs, 0 na zona morta
+
+  // Aprendizado em andamento
+  joystick_cal_phase_t phase;
+  bool full; // Aprende também mínimo e máximo (senão só o centro)
+  uint32_t phase_start_us;
+  uint32_t sum[JOYSTICK_CAL_AXES];
+  uint32_t samples;
+  uint16_t seen_min[JOYSTICK_CAL_AXES], seen_max[JOYSTICK_CAL_AXES];
+} joystick_cal_t;
+
+void joystick_cal_init(joystick_cal_t *cal, uint8_t span_x, uint8_t span_y);
+void joystick_cal_build(joystick_cal_t *cal);
+void joystick_cal_start(joystick_cal_t *cal, bool full, uint32_t now_us);
+bool joystick_cal_feed(joystick_cal_t *cal, uint16_t x, uint16_t y, uint32_t now_us);
+void joystick_cal_export(const joystick_cal_t *cal, joystick_cal_record_t *record);
+bool joystick_cal_import(joystick_cal_t *cal, const joystick_cal_record_t *record);
+
+// Persistência no último setor da flash (joystick_cal_flash.c)
+bool joystick_cal_load(joystick_cal_t *cal);
+bool joystick_cal_save(const joystick_cal_t *cal);
+
+static inline uint8_t joystick_cal_screen(const joystick_cal_t *cal, uint8_t axis, uint16_t adc)
+{
+  return cal->screen[axis][adc >> JOYSTICK_CAL_LUT_SHIFT];
+}
+
+static inline uint16_t joystick_cal_brightness(const joystick_cal_t *cal, uint8_t axis, uint16_t adc)
+{
+  return cal->brightness[axis][adc >> JOYSTICK_CAL_LUT_SHIFT];
+}
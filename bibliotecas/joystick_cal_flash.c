@@ -0,0 +1,36 @@
+#include <assert.h>
+#include <string.h>
+#include "joystick_cal.h"
+#include "pico/stdlib.h"
+#include "pico/flash.h"
+#include "hardware/flash.h"
+
+// Último setor da flash, longe do programa
+#define JOYSTICK_CAL_FLASH_OFFSET (PICO_FLASH_SIZE_BYTES - FLASH_SECTOR_SIZE)
+
+static_assert(sizeof(joystick_cal_record_t) <= FLASH_PAGE_SIZE, "o registro deve caber numa página da flash");
+
+bool joystick_cal_load(joystick_cal_t *cal)
+{
+  joystick_cal_record_t record;
+  memcpy(&record, (const void *)(XIP_BASE + JOYSTICK_CAL_FLASH_OFFSET), sizeof(record));
+  return joystick_cal_import(cal, &record);
+}
+
+// Roda com a execução a partir da flash suspensa nos dois núcleos
+static void program_record(void *param)
+{
+  flash_range_erase(JOYSTICK_CAL_FLASH_OFFSET, FLASH_SECTOR_SIZE);
+  flash_range_program(JOYSTICK_CAL_FLASH_OFFSET, param, FLASH_PAGE_SIZE);
+}
+
+// flash_safe_execute desliga as interrupções deste núcleo e pausa o outro
+// (que precisa ter chamado flash_safe_execute_core_init) durante o apagamento
+// e a gravação, ~50 ms no total
+bool joystick_cal_save(const joystick_cal_t *cal)
+{
+  static uint8_t page[FLASH_PAGE_SIZE];
+  memset(page, 0xFF, sizeof(page));
+  joystick_cal_export(cal, (joystick_cal_record_t *)page);
+  return flash_safe_execute(program_record, page, 100) == PICO_OK;
+}
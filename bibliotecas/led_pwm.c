@@ -0,0 +1,143 @@
+#include <math.h>
+#include "led_pwm.h"
+#include "pico/stdlib.h"
+#include "hardware/pwm.h"
+#include "hardware/irq.h"
+#include "hardware/clocks.h"
+#include "hardware/sync.h"
+
+// Pontos da curva gama; os valores entre eles são interpolados
+#define LED_PWM_GAMMA_POINTS 256
+#define LED_PWM_GAMMA 2.2f
+
+typedef struct {
+  uint32_t gpio;
+  uint32_t level;     // Brilho atual em ponto fixo 16.16
+  uint32_t target;    // Brilho alvo em 16.16 (0 se desligado)
+  uint32_t step;      // Variação por atualização em 16.16
+  uint16_t requested; // Último brilho pedido pela aplicação
+} led_channel_t;
+
+static led_channel_t channels[LED_PWM_MAX_CHANNELS];
+static size_t channel_count;
+static uint16_t gamma_table[LED_PWM_GAMMA_POINTS + 1];
+static bool enabled = true;
+static uint irq_slice;    // Slice cuja interrupção de wrap avança as transições
+static uint32_t prescale; // Wraps do PWM por atualização
+static uint32_t prescale_count;
+static uint32_t update_rate; // Atualizações por segundo
+
+uint16_t led_pwm_gamma(uint16_t brightness)
+{
+  if (brightness >= LED_PWM_WRAP)
+    return LED_PWM_WRAP;
+  uint32_t index = brightness >> 4;
+  uint32_t fraction = brightness & 0xF;
+  uint32_t low = gamma_table[index];
+  uint32_t high = gamma_table[index + 1];
+  return low + (((high - low) * fraction) >> 4);
+}
+
+// Aproxima o brilho do alvo; retorna se ainda falta chegar
+static bool led_channel_advance(led_channel_t *channel)
+{
+  if (channel->level == channel->target)
+    return false;
+
+  if (channel->level < channel->target)
+    channel->level = (channel->target - channel->level > channel->step) ? channel->level + channel->step : channel->target;
+  else
+    channel->level = (channel->level - channel->target > channel->step) ? channel->level - channel->step : channel->target;
+
+  pwm_set_gpio_level(channel->gpio, led_pwm_gamma(channel->level >> 16));
+  return channel->level != channel->target;
+}
+
+// O wrap acontece a clk_sys / (LED_PWM_WRAP + 1) (~30 kHz); só uma a cada
+// `prescale` interrupções faz trabalho
+static void led_pwm_irq_handler(void)
+{
+  if (!(pwm_get_irq_status_mask() & (1u << irq_slice)))
+    return;
+  pwm_clear_irq(irq_slice);
+
+  if (++prescale_count < prescale)
+    return;
+  prescale_count = 0;
+
+  bool fading = false;
+  for (size_t i = 0; i < channel_count; ++i)
+    fading |= led_channel_advance(&channels[i]);
+  if (!fading)
+    pwm_set_irq_enabled(irq_slice, false);
+}
+
+void led_pwm_init(const uint32_t *gpios, size_t count, uint32_t update_rate_hz)
+{
+  for (int i = 0; i <= LED_PWM_GAMMA_POINTS; ++i)
+    gamma_table[i] = (uint16_t)(powf((float)i / LED_PWM_GAMMA_POINTS, LED_PWM_GAMMA) * LED_PWM_WRAP + 0.5f);
+
+  channel_count = (count < LED_PWM_MAX_CHANNELS) ? count : LED_PWM_MAX_CHANNELS;
+  for (size_t i = 0; i < channel_count; ++i)
+  {
+    channels[i] = (led_channel_t){.gpio = gpios[i]};
+    gpio_set_function(gpios[i], GPIO_FUNC_PWM);
+    uint slice = pwm_gpio_to_slice_num(gpios[i]);
+    pwm_config config = pwm_get_default_config();
+    pwm_config_set_clkdiv(&config, 1.0f); // Sem divisor, para evitar flickering
+    pwm_config_set_wrap(&config, LED_PWM_WRAP);
+    pwm_init(slice, &config, true);
+    pwm_set_gpio_level(gpios[i], 0);
+  }
+
+  update_rate = update_rate_hz;
+  prescale = clock_get_hz(clk_sys) / (LED_PWM_WRAP + 1) / update_rate_hz;
+  if (prescale == 0)
+    prescale = 1;
+
+  irq_slice = pwm_gpio_to_slice_num(gpios[0]);
+  pwm_clear_irq(irq_slice);
+  irq_add_shared_handler(PWM_IRQ_WRAP, led_pwm_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+  irq_set_enabled(PWM_IRQ_WRAP, true);
+}
+
+// Recalcula alvo e passo de um LED e liga a interrupção. Roda com as
+// interrupções desligadas para a interrupção nunca ver um alvo novo com o
+// passo antigo.
+static void led_channel_retarget(led_channel_t *channel, uint32_t fade_ms)
+{
+  uint32_t target = (uint32_t)(enabled ? channel->requested : 0) << 16;
+  uint32_t updates = fade_ms * update_rate / 1000;
+  if (updates == 0)
+    updates = 1;
+
+  uint32_t save = save_and_disable_interrupts();
+  if (channel->target != target || channel->level != target)
+  {
+    uint32_t distance = (target > channel->level) ? target - channel->level : channel->level - target;
+    channel->target = target;
+    channel->step = (distance / updates) ? distance / updates : 1;
+    pwm_set_irq_enabled(irq_slice, true);
+  }
+  restore_interrupts(save);
+}
+
+void led_pwm_set(size_t channel, uint16_t brightness, uint32_t fade_ms)
+{
+  if (channel >= channel_count)
+    return;
+  channels[channel].requested = (brightness < LED_PWM_WRAP) ? brightness : LED_PWM_WRAP;
+  led_channel_retarget(&channels[channel], fade_ms);
+}
+
+void led_pwm_set_enabled(bool value, uint32_t fade_ms)
+{
+  enabled = value;
+  for (size_t i = 0; i < channel_count; ++i)
+    led_channel_retarget(&channels[i], fade_ms);
+}
+
+uint16_t led_pwm_brightness(size_t channel)
+{
+  return (channel < channel_count) ? channels[channel].level >> 16 : 0;
+}
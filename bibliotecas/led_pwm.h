@@ -0,0 +1,17 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Máximo de LEDs controlados e resolução do PWM (mesma do ADC)
+#define LED_PWM_MAX_CHANNELS 4
+#define LED_PWM_WRAP 4095
+
+// Motor dos LEDs em PWM: a aplicação define o brilho percebido (linear, de 0
+// a LED_PWM_WRAP) e o tempo de transição; a interrupção de wrap do PWM avança
+// cada LED até o alvo, passando pela curva gama, a update_rate_hz. Fora das
+// transições a interrupção fica desligada, então não gasta CPU.
+void led_pwm_init(const uint32_t *gpios, size_t count, uint32_t update_rate_hz);
+void led_pwm_set(size_t channel, uint16_t brightness, uint32_t fade_ms);
+void led_pwm_set_enabled(bool enabled, uint32_t fade_ms); // Desligado: todos vão a 0, guardando os alvos
+uint16_t led_pwm_brightness(size_t channel);             // Brilho atual (linear) da transição em andamento
+uint16_t led_pwm_gamma(uint16_t brightness);             // Nível do PWM para um brilho linear
@@ -0,0 +1,54 @@
+#include <stdlib.h>
+#include "presented_state.h"
+
+// Começa sem nada apresentado (o primeiro quadro sempre é desenhado) e com
+// os eixos no centro
+void presented_state_init(presented_state_t *state, uint16_t hysteresis)
+{
+  state->hysteresis = hysteresis;
+  for (uint8_t axis = 0; axis < PRESENTED_ADC_AXES; ++axis)
+    state->held_adc[axis] = 2048;
+  state->pwm_red = 0;
+  state->pwm_blue = 0;
+  presented_state_invalidate(state);
+}
+
+// Só aceita um novo valor do ADC quando ele se afasta mais que a histerese
+// do último aceito; retorna o valor aceito
+uint16_t presented_state_hold_adc(presented_state_t *state, uint8_t axis, uint16_t value)
+{
+  uint16_t *held = &state->held_adc[axis];
+  if (abs((int32_t)value - *held) > state->hysteresis)
+    *held = value;
+  return *held;
+}
+
+// Guarda o conteúdo do quadro como apresentado. Retorna se ele difere do
+// anterior, ou seja, se o quadro precisa ser desenhado e enviado.
+bool presented_state_set_screen(presented_state_t *state, const presented_screen_t *screen)
+{
+  const presented_screen_t *shown = &state->screen;
+  bool changed = screen->square_x != shown->square_x || screen->square_y != shown->square_y ||
+                 screen->border_style != shown->border_style || screen->adc_x != shown->adc_x ||
+                 screen->adc_y != shown->adc_y || screen->fps != shown->fps;
+  if (changed)
+    state->screen = *screen;
+  return changed;
+}
+
+// Mesmo esquema para os níveis dos LEDs
+bool presented_state_set_pwm(presented_state_t *state, uint16_t red, uint16_t blue)
+{
+  bool changed = red != state->pwm_red || blue != state->pwm_blue;
+  state->pwm_red = red;
+  state->pwm_blue = blue;
+  return changed;
+}
+
+// Quadro não apresentado (ex.: sem buffer livre no pipeline): o próximo
+// presented_state_set_screen sempre indica mudança. Estilo inválido e
+// posição fora da tela nunca coincidem com um quadro real.
+void presented_state_invalidate(presented_state_t *state)
+{
+  state->screen = (presented_screen_t){.square_x = -1, .square_y = -1, .border_style = 0xFF};
+}
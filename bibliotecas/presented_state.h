@@ -0,0 +1,30 @@
+#include <stdint.h>
+#include <stdbool.h>
+
+// Número de eixos do joystick com histerese (x e y)
+#define PRESENTED_ADC_AXES 2
+
+// Conteúdo da tela de um quadro: dois quadros com o mesmo conteúdo são
+// iguais no display. Os campos do HUD ficam em 0 quando ele não é mostrado.
+typedef struct {
+  int16_t square_x, square_y;
+  uint8_t border_style;
+  uint16_t adc_x, adc_y, fps; // Valores mostrados no HUD
+} presented_screen_t;
+
+// Estado mostrado pelo último quadro apresentado, para só desenhar e enviar
+// quando algo visível muda (e só atualizar o PWM quando os níveis mudam).
+// As leituras do ADC passam antes por uma histerese: ruído abaixo dela mantém
+// o valor já aceito e não gera quadro.
+typedef struct {
+  presented_screen_t screen;
+  uint16_t pwm_red, pwm_blue;
+  uint16_t hysteresis;                  // Variação mínima, em contagens de 12 bits (0 = sem histerese)
+  uint16_t held_adc[PRESENTED_ADC_AXES]; // Último valor aceito de cada eixo
+} presented_state_t;
+
+void presented_state_init(presented_state_t *state, uint16_t hysteresis);
+uint16_t presented_state_hold_adc(presented_state_t *state, uint8_t axis, uint16_t value);
+bool presented_state_set_screen(presented_state_t *state, const presented_screen_t *screen);
+bool presented_state_set_pwm(presented_state_t *state, uint16_t red, uint16_t blue);
+void presented_state_invalidate(presented_state_t *state);
@@ -1,131 +1,647 @@
+#include <string.h>
 #include "ssd1306.h"
 #include "font.h"
+#include "border_layers.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+
+// Tamanho máximo de cada transação de dados enviada por ssd1306_send_dirty
+#define SSD1306_DIRTY_CHUNK 256
+
+// Máximo de comandos por transação em ssd1306_command_list
+#define SSD1306_COMMAND_LIST_MAX 32
+
+// Display dono de cada canal DMA, usado pelo handler de interrupção compartilhado
+static ssd1306_t *dma_owners[NUM_DMA_CHANNELS];
+static bool dma_irq_installed = false;
+
+// Display esperando o STOP final em cada controlador I2C
+static ssd1306_t *i2c_finishing[NUM_I2CS];
+static bool i2c_irq_installed[NUM_I2CS];
+
+static void ssd1306_wait_bus(ssd1306_t *ssd);
+
+static void i2c_write_commands(ssd1306_t *ssd, const uint8_t *commands, size_t count);
+static void i2c_write_data(ssd1306_t *ssd, uint8_t *data, size_t count);
+static void i2c_start_async(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1);
+static bool i2c_busy(ssd1306_t *ssd);
+static void i2c_finish_async(ssd1306_t *ssd);
+
+const ssd1306_transport_t ssd1306_i2c_transport = {
+    .write_commands = i2c_write_commands,
+    .write_data = i2c_write_data,
+    .start_async = i2c_start_async,
+    .busy = i2c_busy,
+    .finish_async = i2c_finish_async,
+};
 
 void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c)
+{
+  uint8_t *buffer = calloc(SSD1306_BUFFER_SIZE(width, height), sizeof(uint8_t));
+  ssd1306_init_with_buffer(ssd, width, height, external_vcc, address, i2c, buffer);
+}
+
+// Igual a ssd1306_init, mas usa um buffer do chamador (estático, por exemplo)
+// com SSD1306_BUFFER_SIZE(width, height) bytes, sem alocação dinâmica
+void ssd1306_init_with_buffer(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address,
+                              i2c_inst_t *i2c, uint8_t *buffer)
 {
   ssd->width = width;
   ssd->height = height;
   ssd->pages = height / 8U;
   ssd->address = address;
-  ssd->i2c_port = i2c;
-  ssd->bufsize = ssd->pages * ssd->width + 1;
-  ssd->ram_buffer = calloc(ssd->bufsize, sizeof(uint8_t));
+  ssd->transport = &ssd1306_i2c_transport;
+  ssd->bus = i2c;
+  ssd->bufsize = SSD1306_BUFFER_SIZE(width, height);
+  ssd->ram_buffer = buffer;
+  memset(ssd->ram_buffer, 0, ssd->bufsize);
   ssd->ram_buffer[0] = 0x40;
-  ssd->port_buffer[0] = 0x80;
+  ssd->dma_buffer = NULL;
+  ssd->dma_channel = -1;
+  ssd->flush_callback = NULL;
+
+  // O conteúdo da RAM do display é desconhecido até o primeiro envio
+  ssd1306_clear_dirty(ssd);
+  ssd1306_mark_dirty(ssd, 0, 0, width - 1, height - 1);
+}
+
+// Troca o transporte (SPI, simulado...) antes de ssd1306_config e de
+// ssd1306_async_init. bus identifica o controlador usado.
+void ssd1306_set_transport(ssd1306_t *ssd, const ssd1306_transport_t *transport, void *bus)
+{
+  ssd->transport = transport;
+  ssd->bus = bus;
 }
 
 void ssd1306_config(ssd1306_t *ssd)
 {
-  ssd1306_command(ssd, SET_DISP | 0x00);
-  ssd1306_command(ssd, SET_MEM_ADDR);
-  ssd1306_command(ssd, 0x01);
-  ssd1306_command(ssd, SET_DISP_START_LINE | 0x00);
-  ssd1306_command(ssd, SET_SEG_REMAP | 0x01);
-  ssd1306_command(ssd, SET_MUX_RATIO);
-  ssd1306_command(ssd, HEIGHT - 1);
-  ssd1306_command(ssd, SET_COM_OUT_DIR | 0x08);
-  ssd1306_command(ssd, SET_DISP_OFFSET);
-  ssd1306_command(ssd, 0x00);
-  ssd1306_command(ssd, SET_COM_PIN_CFG);
-  ssd1306_command(ssd, 0x12);
-  ssd1306_command(ssd, SET_DISP_CLK_DIV);
-  ssd1306_command(ssd, 0x80);
-  ssd1306_command(ssd, SET_PRECHARGE);
-  ssd1306_command(ssd, 0xF1);
-  ssd1306_command(ssd, SET_VCOM_DESEL);
-  ssd1306_command(ssd, 0x30);
-  ssd1306_command(ssd, SET_CONTRAST);
-  ssd1306_command(ssd, 0xFF);
-  ssd1306_command(ssd, SET_ENTIRE_ON);
-  ssd1306_command(ssd, SET_NORM_INV);
-  ssd1306_command(ssd, SET_CHARGE_PUMP);
-  ssd1306_command(ssd, 0x14);
-  ssd1306_command(ssd, SET_DISP | 0x01);
+  const uint8_t commands[] = {
+      SET_DISP | 0x00,
+      SET_MEM_ADDR, 0x01,
+      SET_DISP_START_LINE | 0x00,
+      SET_SEG_REMAP | 0x01,
+      SET_MUX_RATIO, ssd->height - 1,
+      SET_COM_OUT_DIR | 0x08,
+      SET_DISP_OFFSET, 0x00,
+      SET_COM_PIN_CFG, (ssd->height > 32) ? 0x12 : 0x02, // Alternativo para 64 linhas, sequencial para 32 ou 16
+      SET_DISP_CLK_DIV, 0x80,
+      SET_PRECHARGE, 0xF1,
+      SET_VCOM_DESEL, 0x30,
+      SET_CONTRAST, 0xFF,
+      SET_ENTIRE_ON,
+      SET_NORM_INV,
+      SET_CHARGE_PUMP, 0x14,
+      SET_DISP | 0x01};
+  ssd1306_command_list(ssd, commands, sizeof(commands));
 }
 
 void ssd1306_command(ssd1306_t *ssd, uint8_t command)
 {
-  ssd->port_buffer[1] = command;
-  i2c_write_blocking(
-      ssd->i2c_port,
-      ssd->address,
-      ssd->port_buffer,
-      2,
-      false);
+  ssd1306_command_list(ssd, &command, 1);
+}
+
+// Envia vários comandos de uma vez, numa única transação quando o
+// transporte permite
+void ssd1306_command_list(ssd1306_t *ssd, const uint8_t *commands, size_t count)
+{
+  ssd1306_wait_bus(ssd);
+  ssd->transport->write_commands(ssd, commands, count);
+}
+
+// Transporte I2C: com o byte de controle 0x00 (Co = 0, D/C = 0) o display
+// interpreta todos os bytes seguintes como comandos, em vez de um endereço +
+// controle por comando
+static void i2c_write_commands(ssd1306_t *ssd, const uint8_t *commands, size_t count)
+{
+  uint8_t buffer[SSD1306_COMMAND_LIST_MAX + 1];
+  buffer[0] = 0x00;
+
+  while (count > 0)
+  {
+    size_t chunk = (count < SSD1306_COMMAND_LIST_MAX) ? count : SSD1306_COMMAND_LIST_MAX;
+    memcpy(buffer + 1, commands, chunk);
+    i2c_write_blocking(ssd->bus, ssd->address, buffer, chunk + 1, false);
+    commands += chunk;
+    count -= chunk;
+  }
+}
+
+// Os dados vão numa transação só, com o byte de controle 0x40 (dados da
+// GDDRAM) escrito temporariamente na posição anterior a eles
+static void i2c_write_data(ssd1306_t *ssd, uint8_t *data, size_t count)
+{
+  uint8_t saved = data[-1];
+  data[-1] = 0x40;
+  i2c_write_blocking(ssd->bus, ssd->address, data - 1, count + 1, false);
+  data[-1] = saved;
+}
+
+// Rolagem contínua feita pelo próprio controlador: depois de ativada o display
+// desloca as páginas [page0, page1] a cada intervalo sem nenhum envio. Cada
+// chamada para a rolagem anterior antes de mudar os parâmetros, como exige o
+// datasheet, e tudo vai numa única lista de comandos.
+void ssd1306_scroll_horizontal(ssd1306_t *ssd, bool left, uint8_t page0, uint8_t page1, ssd1306_scroll_interval_t interval)
+{
+  const uint8_t commands[] = {
+      SET_SCROLL_OFF,
+      left ? SET_HSCROLL_LEFT : SET_HSCROLL_RIGHT, 0x00, page0 & 0x07, interval, page1 & 0x07, 0x00, 0xFF,
+      SET_SCROLL_ON};
+  ssd1306_command_list(ssd, commands, sizeof(commands));
+}
+
+// Rolagem horizontal das páginas [page0, page1] combinada com um deslocamento
+// vertical de vertical_step linhas por passo, dentro da área definida por
+// ssd1306_set_vertical_scroll_area
+void ssd1306_scroll_diagonal(ssd1306_t *ssd, bool left, uint8_t page0, uint8_t page1, ssd1306_scroll_interval_t interval,
+                             uint8_t vertical_step)
+{
+  const uint8_t commands[] = {
+      SET_SCROLL_OFF,
+      left ? SET_VHSCROLL_LEFT : SET_VHSCROLL_RIGHT, 0x00, page0 & 0x07, interval, page1 & 0x07, vertical_step & 0x3F,
+      SET_SCROLL_ON};
+  ssd1306_command_list(ssd, commands, sizeof(commands));
+}
+
+// Linhas fixas no topo e quantidade de linhas que rolam na vertical
+void ssd1306_set_vertical_scroll_area(ssd1306_t *ssd, uint8_t fixed_rows, uint8_t scroll_rows)
+{
+  const uint8_t commands[] = {SET_VSCROLL_AREA, fixed_rows & 0x3F, scroll_rows & 0x7F};
+  ssd1306_command_list(ssd, commands, sizeof(commands));
+}
+
+// Para a rolagem. O conteúdo mostrado fica deslocado em relação à RAM: para
+// voltar ao quadro original é preciso reenviá-lo (ssd1306_send_data).
+void ssd1306_scroll_stop(ssd1306_t *ssd)
+{
+  const uint8_t commands[] = {SET_SCROLL_OFF};
+  ssd1306_command_list(ssd, commands, sizeof(commands));
+}
+
+// Linha da RAM mostrada no topo da tela. Variar este valor rola a imagem na
+// vertical (com volta) ao custo de um comando por passo, sem reenviar o quadro.
+void ssd1306_set_start_line(ssd1306_t *ssd, uint8_t line)
+{
+  const uint8_t commands[] = {SET_DISP_START_LINE | (line & 0x3F)};
+  ssd1306_command_list(ssd, commands, sizeof(commands));
+}
+
+// Define a janela de colunas/páginas que os próximos dados vão preencher
+static void ssd1306_set_window(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1)
+{
+  const uint8_t commands[] = {SET_COL_ADDR, x0, x1, SET_PAGE_ADDR, page0, page1};
+  ssd1306_command_list(ssd, commands, sizeof(commands));
 }
 
 void ssd1306_send_data(ssd1306_t *ssd)
 {
-  ssd1306_command(ssd, SET_COL_ADDR);
-  ssd1306_command(ssd, 0);
-  ssd1306_command(ssd, ssd->width - 1);
-  ssd1306_command(ssd, SET_PAGE_ADDR);
-  ssd1306_command(ssd, 0);
-  ssd1306_command(ssd, ssd->pages - 1);
-  i2c_write_blocking(
-      ssd->i2c_port,
-      ssd->address,
-      ssd->ram_buffer,
-      ssd->bufsize,
-      false);
+  ssd1306_set_window(ssd, 0, ssd->width - 1, 0, ssd->pages - 1);
+  ssd->transport->write_data(ssd, ssd->ram_buffer + 1, ssd->bufsize - 1);
+  ssd1306_clear_dirty(ssd);
 }
 
-void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value)
+void ssd1306_mark_dirty(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
 {
-  uint16_t index = (y >> 3) + (x << 3) + 1;
-  uint8_t pixel = (y & 0b111);
-  if (value)
-    ssd->ram_buffer[index] |= (1 << pixel);
-  else
-    ssd->ram_buffer[index] &= ~(1 << pixel);
+  uint8_t page0 = y0 >> 3;
+  uint8_t page1 = y1 >> 3;
+  if (x0 < ssd->dirty_x0)
+    ssd->dirty_x0 = x0;
+  if (x1 > ssd->dirty_x1)
+    ssd->dirty_x1 = x1;
+  if (page0 < ssd->dirty_page0)
+    ssd->dirty_page0 = page0;
+  if (page1 > ssd->dirty_page1)
+    ssd->dirty_page1 = page1;
 }
 
-/*
-void ssd1306_fill(ssd1306_t *ssd, bool value) {
-  uint8_t byte = value ? 0xFF : 0x00;
-  for (uint8_t i = 1; i < ssd->bufsize; ++i)
-    ssd->ram_buffer[i] = byte;
-}*/
+void ssd1306_clear_dirty(ssd1306_t *ssd)
+{
+  ssd->dirty_x0 = 0xFF;
+  ssd->dirty_x1 = 0;
+  ssd->dirty_page0 = 0xFF;
+  ssd->dirty_page1 = 0;
+}
 
-void ssd1306_fill(ssd1306_t *ssd, bool value)
+// Envia apenas a janela de colunas/páginas alterada desde o último envio.
+// No modo de endereçamento vertical (SET_MEM_ADDR 0x01) o display percorre
+// as páginas de cada coluna antes de avançar, então os bytes são enviados
+// na mesma ordem, em blocos de até SSD1306_DIRTY_CHUNK bytes por transação
+// (ou numa transação só, direto do ram_buffer, quando a janela tem todas as páginas).
+void ssd1306_send_dirty(ssd1306_t *ssd)
 {
-  // Itera por todas as posições do display
-  for (uint8_t y = 0; y < ssd->height; ++y)
+  uint8_t x0 = ssd->dirty_x0;
+  uint8_t x1 = (ssd->dirty_x1 < ssd->width) ? ssd->dirty_x1 : ssd->width - 1;
+  uint8_t page0 = ssd->dirty_page0;
+  uint8_t page1 = (ssd->dirty_page1 < ssd->pages) ? ssd->dirty_page1 : ssd->pages - 1;
+
+  ssd1306_clear_dirty(ssd);
+  if (x0 > x1 || page0 > page1)
+    return; // Nada mudou
+  ssd1306_send_window(ssd, x0, x1, page0, page1);
+}
+
+// Envia uma janela qualquer do ram_buffer (colunas x0..x1, páginas
+// page0..page1), sem mexer na região alterada
+void ssd1306_send_window(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1)
+{
+  ssd1306_set_window(ssd, x0, x1, page0, page1);
+
+  if (page0 == 0 && page1 == ssd->pages - 1)
+  {
+    // Colunas inteiras já estão contíguas no ram_buffer; o byte anterior à
+    // janela serve de data[-1] ao transporte
+    ssd->transport->write_data(ssd, &ssd->ram_buffer[ssd1306_index(ssd, x0, 0)], (x1 - x0 + 1) * ssd->pages);
+    return;
+  }
+
+  uint8_t chunk[SSD1306_DIRTY_CHUNK + 1]; // chunk[0] é o data[-1] do transporte
+  size_t count = 0;
+  for (uint16_t x = x0; x <= x1; ++x)
   {
-    for (uint8_t x = 0; x < ssd->width; ++x)
+    for (uint8_t page = page0; page <= page1; ++page)
     {
-      ssd1306_pixel(ssd, x, y, value);
+      chunk[++count] = ssd->ram_buffer[ssd1306_index(ssd, x, page)];
+      if (count == SSD1306_DIRTY_CHUNK)
+      {
+        ssd->transport->write_data(ssd, chunk + 1, count);
+        count = 0;
+      }
     }
   }
+  if (count > 0)
+    ssd->transport->write_data(ssd, chunk + 1, count);
 }
 
-void ssd1306_rect(ssd1306_t *ssd, uint8_t top, uint8_t left, uint8_t width, uint8_t height, bool value, bool fill)
+static void ssd1306_dma_irq_handler(void)
 {
-  for (uint8_t x = left; x < left + width; ++x)
+  for (uint channel = 0; channel < NUM_DMA_CHANNELS; ++channel)
   {
-    ssd1306_pixel(ssd, x, top, value);
-    ssd1306_pixel(ssd, x, top + height - 1, value);
+    ssd1306_t *ssd = dma_owners[channel];
+    if (ssd && dma_channel_get_irq0_status(channel))
+    {
+      dma_channel_acknowledge_irq0(channel);
+      if (ssd->transport->finish_async)
+      {
+        ssd->transport->finish_async(ssd);
+        continue;
+      }
+      if (!ssd->flush_callback)
+        continue;
+      while (ssd->transport->busy(ssd))
+        tight_loop_contents();
+      ssd->flush_callback(ssd);
+    }
   }
-  for (uint8_t y = top; y < top + height; ++y)
+}
+
+// Prepara o envio assíncrono: reserva um canal DMA e o buffer frontal.
+// O buffer usa 16 bits por entrada porque o registrador IC_DATA_CMD do I2C
+// interpreta os bits 8-10 (leitura/STOP/RESTART); escritas de 8 bits via DMA
+// replicariam o byte nesses bits. O callback (opcional) é chamado numa
+// interrupção quando o último byte saiu pelo barramento (no I2C, no STOP
+// final; o fim do DMA só diz que ele entrou na FIFO do controlador).
+// Falha se o transporte não tem envio assíncrono.
+bool ssd1306_async_init(ssd1306_t *ssd, ssd1306_flush_callback_t callback)
+{
+  uint16_t *buffer = calloc(SSD1306_DMA_BUFFER_SIZE(ssd->width, ssd->height), sizeof(uint16_t));
+  if (!buffer)
+    return false;
+  if (!ssd1306_async_init_with_buffer(ssd, callback, buffer))
   {
-    ssd1306_pixel(ssd, left, y, value);
-    ssd1306_pixel(ssd, left + width - 1, y, value);
+    free(buffer);
+    return false;
   }
+  return true;
+}
 
-  if (fill)
+// Igual a ssd1306_async_init, com o buffer frontal do chamador
+// (SSD1306_DMA_BUFFER_SIZE(width, height) entradas)
+bool ssd1306_async_init_with_buffer(ssd1306_t *ssd, ssd1306_flush_callback_t callback, uint16_t *buffer)
+{
+  if (!ssd->transport->start_async)
+    return false;
+
+  int channel = dma_claim_unused_channel(false);
+  if (channel < 0)
+    return false;
+
+  ssd->dma_buffer = buffer;
+  ssd->flush_callback = callback;
+  ssd->dma_channel = channel;
+  dma_owners[channel] = ssd;
+
+  if (!dma_irq_installed)
+  {
+    irq_add_shared_handler(DMA_IRQ_0, ssd1306_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+    dma_irq_installed = true;
+  }
+  dma_channel_set_irq0_enabled(channel, true);
+  return true;
+}
+
+bool ssd1306_flush_busy(ssd1306_t *ssd)
+{
+  return ssd->dma_channel >= 0 && ssd->transport->busy(ssd);
+}
+
+static bool i2c_busy(ssd1306_t *ssd)
+{
+  i2c_hw_t *hw = i2c_get_hw(ssd->bus);
+  if (hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS)
+  {
+    // NACK ou perda de arbitragem: o controlador descarta a FIFO, então o DMA
+    // ficaria parado para sempre. Cancela a transferência e libera o barramento.
+    dma_channel_abort(ssd->dma_channel);
+    (void)hw->clr_tx_abrt;
+    return false;
+  }
+
+  if (dma_channel_is_busy(ssd->dma_channel))
+    return true;
+
+  // O DMA termina quando o último byte entra na FIFO; o barramento ainda
+  // precisa transmiti-lo e gerar o STOP
+  return !(hw->status & I2C_IC_STATUS_TFE_BITS) || (hw->status & I2C_IC_STATUS_MST_ACTIVITY_BITS);
+}
+
+// STOP detectado num controlador com um envio terminando. O STOP da transação
+// de comandos também chega aqui se os dados ainda estavam na FIFO; só o que
+// deixa a FIFO vazia e o controlador parado é o final. Um TX_ABRT também
+// encerra o envio (i2c_busy trata o abort).
+static void ssd1306_i2c_irq_handler(void)
+{
+  for (uint index = 0; index < NUM_I2CS; ++index)
+  {
+    ssd1306_t *ssd = i2c_finishing[index];
+    if (!ssd)
+      continue;
+    i2c_hw_t *hw = i2c_get_hw(ssd->bus);
+    uint32_t raw = hw->raw_intr_stat;
+    if (!(raw & (I2C_IC_RAW_INTR_STAT_STOP_DET_BITS | I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS)))
+      continue;
+    (void)hw->clr_stop_det;
+    if (!(raw & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS) &&
+        (!(hw->status & I2C_IC_STATUS_TFE_BITS) || (hw->status & I2C_IC_STATUS_MST_ACTIVITY_BITS)))
+      continue;
+    hw->intr_mask = 0;
+    i2c_finishing[index] = NULL;
+    ssd->flush_callback(ssd);
+  }
+}
+
+// Fim do DMA: até 16 bytes ainda estão na FIFO (~360 us a 400 kHz). Libera a
+// interrupção de STOP; se o STOP final já aconteceu, ela dispara na hora.
+static void i2c_finish_async(ssd1306_t *ssd)
+{
+  if (!ssd->flush_callback)
+    return; // O STOP final vem sozinho do DMA; sem callback não há o que avisar
+  i2c_hw_t *hw = i2c_get_hw(ssd->bus);
+  i2c_finishing[i2c_hw_index(ssd->bus)] = ssd;
+  hw->intr_mask = I2C_IC_INTR_MASK_M_STOP_DET_BITS | I2C_IC_INTR_MASK_M_TX_ABRT_BITS;
+}
+
+void ssd1306_wait_flush(ssd1306_t *ssd)
+{
+  while (ssd1306_flush_busy(ssd))
+    tight_loop_contents();
+}
+
+// Espera os envios assíncronos de todos os displays no mesmo controlador
+// (o endereço de destino ou o CS e a FIFO são do controlador, não do display)
+static void ssd1306_wait_bus(ssd1306_t *ssd)
+{
+  for (uint channel = 0; channel < NUM_DMA_CHANNELS; ++channel)
+  {
+    ssd1306_t *owner = dma_owners[channel];
+    if (owner && owner->bus == ssd->bus)
+      ssd1306_wait_flush(owner);
+  }
+}
+
+// Monta no buffer frontal a transação de comandos (janela de endereçamento)
+// seguida da transação de dados e dispara o DMA. Depois da cópia o ram_buffer
+// fica livre para o próximo quadro enquanto este ainda está no barramento.
+static void ssd1306_start_async(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1)
+{
+  ssd1306_wait_bus(ssd);
+  ssd->transport->start_async(ssd, x0, x1, page0, page1);
+}
+
+static void i2c_start_async(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1)
+{
+  uint16_t *out = ssd->dma_buffer;
+  *out++ = 0x00; // Byte de controle: sequência de comandos
+  *out++ = SET_COL_ADDR;
+  *out++ = x0;
+  *out++ = x1;
+  *out++ = SET_PAGE_ADDR;
+  *out++ = page0;
+  *out++ = page1 | I2C_IC_DATA_CMD_STOP_BITS;
+  *out++ = 0x40; // Byte de controle: dados da GDDRAM
+  for (uint16_t x = x0; x <= x1; ++x)
+  {
+    for (uint8_t page = page0; page <= page1; ++page)
+      *out++ = ssd->ram_buffer[ssd1306_index(ssd, x, page)];
+  }
+  out[-1] |= I2C_IC_DATA_CMD_STOP_BITS;
+
+  i2c_hw_t *hw = i2c_get_hw(ssd->bus);
+  hw->enable = 0;
+  hw->tar = ssd->address;
+  hw->enable = 1;
+
+  // O callback vem da interrupção de STOP do controlador (i2c_finish_async),
+  // mascarada até o DMA terminar; um STOP antigo não pode dispará-la
+  uint index = i2c_hw_index(ssd->bus);
+  hw->intr_mask = 0;
+  (void)hw->clr_stop_det;
+  if (ssd->flush_callback && !i2c_irq_installed[index])
+  {
+    uint irq = index ? I2C1_IRQ : I2C0_IRQ;
+    irq_add_shared_handler(irq, ssd1306_i2c_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(irq, true);
+    i2c_irq_installed[index] = true;
+  }
+
+  dma_channel_config config = dma_channel_get_default_config(ssd->dma_channel);
+  channel_config_set_transfer_data_size(&config, DMA_SIZE_16);
+  channel_config_set_read_increment(&config, true);
+  channel_config_set_write_increment(&config, false);
+  channel_config_set_dreq(&config, i2c_get_dreq(ssd->bus, true));
+  dma_channel_configure(ssd->dma_channel, &config, &hw->data_cmd, ssd->dma_buffer, out - ssd->dma_buffer, true);
+}
+
+void ssd1306_send_data_async(ssd1306_t *ssd)
+{
+  if (ssd->dma_channel < 0)
+  {
+    ssd1306_send_data(ssd);
+    return;
+  }
+  ssd1306_start_async(ssd, 0, ssd->width - 1, 0, ssd->pages - 1);
+  ssd1306_clear_dirty(ssd);
+}
+
+// Versão assíncrona de ssd1306_send_window (bloqueante sem DMA)
+void ssd1306_send_window_async(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1)
+{
+  if (ssd->dma_channel < 0)
+  {
+    ssd1306_send_window(ssd, x0, x1, page0, page1);
+    return;
+  }
+  ssd1306_start_async(ssd, x0, x1, page0, page1);
+}
+
+void ssd1306_send_dirty_async(ssd1306_t *ssd)
+{
+  if (ssd->dma_channel < 0)
+  {
+    ssd1306_send_dirty(ssd);
+    return;
+  }
+
+  uint8_t x0 = ssd->dirty_x0;
+  uint8_t x1 = (ssd->dirty_x1 < ssd->width) ? ssd->dirty_x1 : ssd->width - 1;
+  uint8_t page0 = ssd->dirty_page0;
+  uint8_t page1 = (ssd->dirty_page1 < ssd->pages) ? ssd->dirty_page1 : ssd->pages - 1;
+
+  ssd1306_clear_dirty(ssd);
+  if (x0 > x1 || page0 > page1)
+    return; // Nada mudou
+  ssd1306_start_async(ssd, x0, x1, page0, page1);
+}
+
+// Envia as regiões alteradas de vários displays e espera todos terminarem.
+// Displays em controladores I2C diferentes, cada um com seu canal DMA, são
+// transmitidos ao mesmo tempo, então o total leva o tempo do maior envio e
+// não a soma. Displays sem DMA são enviados de forma bloqueante enquanto os
+// outros transmitem.
+void ssd1306_send_dirty_all(ssd1306_t *const *displays, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    if (displays[i]->dma_channel >= 0)
+      ssd1306_send_dirty_async(displays[i]);
+  }
+  for (size_t i = 0; i < count; ++i)
+  {
+    if (displays[i]->dma_channel < 0)
+      ssd1306_send_dirty(displays[i]);
+  }
+  for (size_t i = 0; i < count; ++i)
+    ssd1306_wait_flush(displays[i]);
+}
+
+void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value)
+{
+  uint16_t index = ssd1306_index(ssd, x, y >> 3);
+  uint8_t pixel = (y & 0b111);
+  uint8_t byte = ssd->ram_buffer[index];
+  if (value)
+    byte |= (1 << pixel);
+  else
+    byte &= ~(1 << pixel);
+
+  // Só marca a região como alterada quando o byte realmente muda, assim
+  // redesenhar algo idêntico (ex.: a borda) não gera tráfego no I2C
+  if (byte != ssd->ram_buffer[index])
+  {
+    ssd->ram_buffer[index] = byte;
+    ssd1306_mark_dirty(ssd, x, y, x, y);
+  }
+}
+
+// Aplica o valor a todos os pixels do retângulo [x0, x1] x [y0, y1].
+// Como cada byte do buffer guarda 8 linhas de uma coluna, cada página é
+// resolvida com uma única máscara em vez de até 8 chamadas a ssd1306_pixel.
+static void ssd1306_fill_span(ssd1306_t *ssd, int x0, int x1, int y0, int y1, bool value)
+{
+  if (x0 < 0)
+    x0 = 0;
+  if (y0 < 0)
+    y0 = 0;
+  if (x1 >= ssd->width)
+    x1 = ssd->width - 1;
+  if (y1 >= ssd->height)
+    y1 = ssd->height - 1;
+  if (x0 > x1 || y0 > y1)
+    return;
+
+  uint8_t page0 = y0 >> 3;
+  uint8_t page1 = y1 >> 3;
+  uint8_t changed_x0 = 0xFF, changed_x1 = 0, changed_page0 = 0xFF, changed_page1 = 0;
+
+  for (uint8_t page = page0; page <= page1; ++page)
   {
-    for (uint8_t x = left + 1; x < left + width - 1; ++x)
+    uint8_t mask = 0xFF;
+    if (page == page0)
+      mask &= 0xFF << (y0 & 0b111);
+    if (page == page1)
+      mask &= 0xFF >> (7 - (y1 & 0b111));
+
+    for (int x = x0; x <= x1; ++x)
     {
-      for (uint8_t y = top + 1; y < top + height - 1; ++y)
+      uint8_t *byte = &ssd->ram_buffer[ssd1306_index(ssd, x, page)];
+      uint8_t updated = value ? (*byte | mask) : (*byte & ~mask);
+      if (updated != *byte)
       {
-        ssd1306_pixel(ssd, x, y, value);
+        *byte = updated;
+        if (x < changed_x0)
+          changed_x0 = x;
+        if (x > changed_x1)
+          changed_x1 = x;
+        if (page < changed_page0)
+          changed_page0 = page;
+        changed_page1 = page;
       }
     }
   }
+
+  if (changed_x0 <= changed_x1)
+    ssd1306_mark_dirty(ssd, changed_x0, changed_page0 << 3, changed_x1, changed_page1 << 3);
+}
+
+void ssd1306_fill(ssd1306_t *ssd, bool value)
+{
+  memset(ssd->ram_buffer + 1, value ? 0xFF : 0x00, ssd->bufsize - 1);
+  ssd1306_mark_dirty(ssd, 0, 0, ssd->width - 1, ssd->height - 1);
+}
+
+void ssd1306_rect(ssd1306_t *ssd, uint8_t top, uint8_t left, uint8_t width, uint8_t height, bool value, bool fill)
+{
+  if (width == 0 || height == 0)
+    return;
+
+  int right = left + width - 1;
+  int bottom = top + height - 1;
+
+  if (fill)
+  {
+    ssd1306_fill_span(ssd, left, right, top, bottom, value);
+    return;
+  }
+
+  ssd1306_fill_span(ssd, left, right, top, top, value);       // Topo
+  ssd1306_fill_span(ssd, left, right, bottom, bottom, value); // Base
+  ssd1306_fill_span(ssd, left, left, top, bottom, value);     // Lateral esquerda
+  ssd1306_fill_span(ssd, right, right, top, bottom, value);   // Lateral direita
 }
 
 void ssd1306_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, bool value)
 {
+  // Linhas horizontais e verticais (todas as usadas pelas bordas) viram spans
+  if (y0 == y1)
+  {
+    ssd1306_hline(ssd, (x0 < x1) ? x0 : x1, (x0 < x1) ? x1 : x0, y0, value);
+    return;
+  }
+  if (x0 == x1)
+  {
+    ssd1306_vline(ssd, x0, (y0 < y1) ? y0 : y1, (y0 < y1) ? y1 : y0, value);
+    return;
+  }
+
   int dx = abs(x1 - x0);
   int dy = abs(y1 - y0);
 
@@ -159,107 +675,318 @@ void ssd1306_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1
 
 void ssd1306_hline(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y, bool value)
 {
-  for (uint8_t x = x0; x <= x1; ++x)
-    ssd1306_pixel(ssd, x, y, value);
+  ssd1306_fill_span(ssd, x0, x1, y, y, value);
 }
 
 void ssd1306_vline(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value)
 {
-  for (uint8_t y = y0; y <= y1; ++y)
-    ssd1306_pixel(ssd, x, y, value);
+  ssd1306_fill_span(ssd, x, x, y0, y1, value);
 }
 
-// Função para desenhar um caractere
-void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y)
+// Copia colunas de um glyph direto no ram_buffer. Cada coluna da fonte já
+// está no mesmo formato dos bytes do display: com y múltiplo de 8 a coluna
+// é copiada inteira; caso contrário ela é dividida, com deslocamento e
+// máscara, entre a página de y e a seguinte. Retorna se algum byte mudou.
+static bool ssd1306_blit_columns(ssd1306_t *ssd, const uint8_t *columns, uint8_t count, uint8_t x, uint8_t y)
 {
-  uint16_t index = 0;
-  char ver = c;
-  if (c >= 'A' && c <= 'Z')
+  if (x >= ssd->width || y >= ssd->height)
+    return false;
+
+  if (x + count > ssd->width)
+    count = ssd->width - x;
+  uint8_t page = y >> 3;
+  uint8_t shift = y & 0b111;
+  bool has_next_page = shift && page + 1 < ssd->pages;
+  uint8_t mask = 0xFF << shift;
+  bool changed = false;
+
+  for (uint8_t i = 0; i < count; ++i)
   {
-    index = (c - 'A' + 11) * 8; // Para letras maiúsculas
+    uint8_t *byte = &ssd->ram_buffer[ssd1306_index(ssd, x + i, page)];
+    uint8_t updated = (*byte & ~mask) | (uint8_t)(columns[i] << shift);
+    changed |= (updated != *byte);
+    *byte = updated;
+
+    if (has_next_page)
+    {
+      byte = &ssd->ram_buffer[ssd1306_index(ssd, x + i, page + 1)];
+      updated = (*byte & mask) | (columns[i] >> (8 - shift));
+      changed |= (updated != *byte);
+      *byte = updated;
+    }
   }
-  else if (c >= '0' && c <= '9')
+  return changed;
+}
+
+// Copia o glyph de um caractere numa célula de 8x8 sem marcar a região
+// alterada: retorna se algum byte mudou e o envio fica com quem chama (campos
+// do HUD, que têm região própria)
+bool ssd1306_blit_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y)
+{
+  return ssd1306_blit_columns(ssd, font_glyph((uint8_t)c)->columns, FONT_GLYPH_COLUMNS, x, y);
+}
+
+// Função para desenhar um caractere (código Latin-1) numa célula de 8x8
+void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y)
+{
+  if (ssd1306_blit_char(ssd, c, x, y))
+    ssd1306_mark_dirty(ssd, x, y, x + 7, y + 7);
+}
+
+// Próximo caractere de um texto em UTF-8, já como glyph da fonte. Códigos
+// acima do Latin-1 e sequências inválidas aparecem como '?'.
+static const font_glyph_t *ssd1306_next_glyph(const char **str)
+{
+  const uint8_t *s = (const uint8_t *)*str;
+  uint8_t lead = *s++;
+  uint16_t code = '?';
+
+  if (lead < 0x80)
+    code = lead;
+  else if ((lead & 0xE0) == 0xC0 && (*s & 0xC0) == 0x80)
   {
-    index = (c - '0' + 1) * 8; // Adiciona o deslocamento necessário
+    code = ((lead & 0x1F) << 6) | (*s++ & 0x3F);
+    if (code < 0x80 || code >= FONT_CODES)
+      code = '?';
   }
-  else if (c >= 'a' && c <= 'z')
+  else
   {
-    index = (c - 'a' + 37) * 8;
+    // Sequências de 3 ou 4 bytes (ou bytes soltos): pula as continuações
+    while ((*s & 0xC0) == 0x80)
+      ++s;
   }
-  for (uint8_t i = 0; i < 8; ++i)
+
+  *str = (const char *)s;
+  return font_glyph((uint8_t)code);
+}
+
+// Largura em pixels do texto proporcional de ssd1306_draw_string, sem
+// quebra de linha
+uint16_t ssd1306_string_width(const char *str)
+{
+  uint16_t width = 0;
+  while (*str)
+    width += ssd1306_next_glyph(&str)->width + FONT_SPACING;
+  return width ? width - FONT_SPACING : 0;
+}
+
+// Operações de ssd1306_sprite_apply
+typedef enum {
+  SPRITE_STAMP,   // Desenha sem salvar o fundo
+  SPRITE_CAPTURE, // Salva o fundo e desenha
+  SPRITE_RESTORE  // Devolve o fundo salvo
+} sprite_op_t;
+
+// Aplica o sprite na posição (x, y) coluna por coluna. Cada byte do bitmap é
+// deslocado para a página de destino e o excedente segue para a página
+// seguinte (como em ssd1306_blit_columns); só os bits cobertos pelo sprite são
+// alterados e apenas a área dos bytes que mudaram é marcada.
+static void ssd1306_sprite_apply(ssd1306_t *ssd, const ssd1306_sprite_t *sprite, int16_t x, int16_t y, sprite_op_t op)
+{
+  uint8_t src_pages = (sprite->height + 7) >> 3;
+  uint8_t bg_pages = (sprite->height + 14) >> 3;
+  uint8_t last_mask = (sprite->height & 0b111) ? 0xFF >> (8 - (sprite->height & 0b111)) : 0xFF;
+  uint8_t shift = y & 0b111;
+  int page0 = (y - shift) / 8;
+  uint8_t changed_x0 = 0xFF, changed_x1 = 0, changed_page0 = 0xFF, changed_page1 = 0;
+
+  for (uint8_t i = 0; i < sprite->width; ++i)
   {
-    uint8_t line = font[index + i];
-    for (uint8_t j = 0; j < 8; ++j)
+    int column = x + i;
+    if (column < 0 || column >= ssd->width)
+      continue;
+
+    uint8_t *saved = sprite->background ? sprite->background + i * bg_pages : NULL;
+    uint8_t carry_value = 0, carry_mask = 0;
+    for (uint8_t k = 0; k <= src_pages; ++k)
     {
-      ssd1306_pixel(ssd, x + i, y + j, line & (1 << j));
+      uint8_t mask = 0, value = 0;
+      if (k < src_pages)
+      {
+        mask = (k + 1 == src_pages) ? last_mask : 0xFF;
+        value = (sprite->bitmap ? sprite->bitmap[i * src_pages + k] : 0xFF) & mask;
+      }
+      uint8_t dest_mask = (uint8_t)(mask << shift) | carry_mask;
+      uint8_t dest_value = (uint8_t)(value << shift) | carry_value;
+      carry_mask = shift ? mask >> (8 - shift) : 0;
+      carry_value = shift ? value >> (8 - shift) : 0;
+
+      int page = page0 + k;
+      if (!dest_mask || page < 0 || page >= ssd->pages)
+        continue;
+
+      uint8_t *byte = &ssd->ram_buffer[ssd1306_index(ssd, column, page)];
+      uint8_t updated;
+      if (sprite->mode == SSD1306_SPRITE_XOR)
+      {
+        updated = *byte ^ dest_value;
+      }
+      else if (op == SPRITE_RESTORE)
+      {
+        updated = (*byte & ~dest_mask) | (saved[k] & dest_mask);
+      }
+      else
+      {
+        if (op == SPRITE_CAPTURE)
+          saved[k] = *byte;
+        updated = (*byte & ~dest_mask) | dest_value;
+      }
+
+      if (updated != *byte)
+      {
+        *byte = updated;
+        if (column < changed_x0)
+          changed_x0 = column;
+        changed_x1 = column;
+        if (page < changed_page0)
+          changed_page0 = page;
+        if (page > changed_page1)
+          changed_page1 = page;
+      }
     }
   }
+
+  if (changed_x0 <= changed_x1)
+    ssd1306_mark_dirty(ssd, changed_x0, changed_page0 << 3, changed_x1, changed_page1 << 3);
+}
+
+// background precisa de SSD1306_SPRITE_BACKGROUND_SIZE(width, height) bytes
+// no modo BACKGROUND e pode ser NULL no modo XOR
+void ssd1306_sprite_init(ssd1306_sprite_t *sprite, uint8_t width, uint8_t height, const uint8_t *bitmap,
+                         ssd1306_sprite_mode_t mode, uint8_t *background)
+{
+  sprite->x = 0;
+  sprite->y = 0;
+  sprite->width = width;
+  sprite->height = height;
+  sprite->bitmap = bitmap;
+  sprite->mode = mode;
+  sprite->background = background;
+  sprite->visible = false;
+  ssd1306_sprite_set_bounds(sprite, INT16_MIN, INT16_MAX, INT16_MIN, INT16_MAX);
+}
+
+void ssd1306_sprite_set_bounds(ssd1306_sprite_t *sprite, int16_t min_x, int16_t max_x, int16_t min_y, int16_t max_y)
+{
+  sprite->min_x = min_x;
+  sprite->max_x = max_x;
+  sprite->min_y = min_y;
+  sprite->max_y = max_y;
+}
+
+// Limita (x, y) aos limites do sprite
+void ssd1306_sprite_clamp(const ssd1306_sprite_t *sprite, int16_t *x, int16_t *y)
+{
+  *x = (*x < sprite->min_x) ? sprite->min_x : (*x > sprite->max_x) ? sprite->max_x : *x;
+  *y = (*y < sprite->min_y) ? sprite->min_y : (*y > sprite->max_y) ? sprite->max_y : *y;
+}
+
+// Move o sprite (e o mostra, se estava escondido): devolve o fundo da posição
+// antiga e desenha na nova, sem tocar no resto do quadro
+void ssd1306_sprite_move(ssd1306_t *ssd, ssd1306_sprite_t *sprite, int16_t x, int16_t y)
+{
+  ssd1306_sprite_clamp(sprite, &x, &y);
+  if (sprite->visible && x == sprite->x && y == sprite->y)
+    return;
+
+  ssd1306_sprite_hide(ssd, sprite);
+  sprite->x = x;
+  sprite->y = y;
+  ssd1306_sprite_apply(ssd, sprite, x, y, SPRITE_CAPTURE);
+  sprite->visible = true;
+}
+
+void ssd1306_sprite_hide(ssd1306_t *ssd, ssd1306_sprite_t *sprite)
+{
+  if (!sprite->visible)
+    return;
+  ssd1306_sprite_apply(ssd, sprite, sprite->x, sprite->y, SPRITE_RESTORE);
+  sprite->visible = false;
+}
+
+// Esquece o fundo salvo sem restaurá-lo. Usado quando o quadro sob o sprite
+// foi redesenhado por inteiro (ex.: troca de borda); o próximo
+// ssd1306_sprite_move salva o novo fundo.
+void ssd1306_sprite_invalidate(ssd1306_sprite_t *sprite)
+{
+  sprite->visible = false;
+}
+
+// Desenha uma cópia do sprite em (x, y) sem salvar fundo nem mudar o estado do sprite
+void ssd1306_sprite_stamp(ssd1306_t *ssd, const ssd1306_sprite_t *sprite, int16_t x, int16_t y)
+{
+  ssd1306_sprite_apply(ssd, sprite, x, y, SPRITE_STAMP);
 }
 
 void draw_square(ssd1306_t *display, int x, int y) {
-    ssd1306_rect(display, y, x, SQUARE_SIZE, SQUARE_SIZE, true, true);
+    static const ssd1306_sprite_t square = {.width = SQUARE_SIZE, .height = SQUARE_SIZE};
+    ssd1306_sprite_stamp(display, &square, x, y);
 }
 
-// Desenha borda estilizada no display (0-5 estilos)
-void draw_border(ssd1306_t *display, uint8_t style)
+// Desenha borda estilizada no display (0-5 estilos) primitiva por primitiva.
+// Usada para gerar as camadas de border_layers.h e para displays de outro tamanho.
+void draw_border_raster(ssd1306_t *display, uint8_t style)
 {
+  const uint8_t width = display->width;
+  const uint8_t height = display->height;
+
   switch (style % 6)
   {       // 6 estilos diferentes
   case 0: // Estilo minimalista
-    ssd1306_rect(display, 0, 0, WIDTH, HEIGHT, true, false);
+    ssd1306_rect(display, 0, 0, width, height, true, false);
     break;
 
   case 1: // Moldura dupla moderna
-    ssd1306_rect(display, 0, 0, WIDTH, HEIGHT, true, false);
-    ssd1306_rect(display, 3, 3, WIDTH - 6, HEIGHT - 6, true, false);
+    ssd1306_rect(display, 0, 0, width, height, true, false);
+    ssd1306_rect(display, 3, 3, width - 6, height - 6, true, false);
     break;
 
   case 2: // Cantos estilizados
     // Linhas principais
-    ssd1306_rect(display, 4, 4, WIDTH - 8, HEIGHT - 8, true, false);
+    ssd1306_rect(display, 4, 4, width - 8, height - 8, true, false);
 
     // Detalhes decorativos nos cantos
     ssd1306_line(display, 0, 0, 7, 0, true);                                                                   // Topo esquerdo
     ssd1306_line(display, 0, 0, 0, 7, true);                                                                   // Lateral esquerda
-    ssd1306_line(display, WIDTH - 1, 0, WIDTH - 8, 0, true);                                   // Topo direito
-    ssd1306_line(display, WIDTH - 1, 0, WIDTH - 1, 7, true);                                   // Lateral direita
-    ssd1306_line(display, 0, HEIGHT - 1, 7, HEIGHT - 1, true);                                 // Base esquerda
-    ssd1306_line(display, 0, HEIGHT - 8, 0, HEIGHT - 1, true);                                 // Lateral esquerda
-    ssd1306_line(display, WIDTH - 1, HEIGHT - 1, WIDTH - 8, HEIGHT - 1, true); // Base direita
-    ssd1306_line(display, WIDTH - 1, HEIGHT - 8, WIDTH - 1, HEIGHT - 1, true); // Lateral direita
+    ssd1306_line(display, width - 1, 0, width - 8, 0, true);                                   // Topo direito
+    ssd1306_line(display, width - 1, 0, width - 1, 7, true);                                   // Lateral direita
+    ssd1306_line(display, 0, height - 1, 7, height - 1, true);                                 // Base esquerda
+    ssd1306_line(display, 0, height - 8, 0, height - 1, true);                                 // Lateral esquerda
+    ssd1306_line(display, width - 1, height - 1, width - 8, height - 1, true); // Base direita
+    ssd1306_line(display, width - 1, height - 8, width - 1, height - 1, true); // Lateral direita
     break;
 
   case 3: // Efeito tridimensional
     // Sombras
-    ssd1306_line(display, 1, 1, WIDTH - 2, 1, true);  // Topo
-    ssd1306_line(display, 1, 1, 1, HEIGHT - 2, true); // Lateral
+    ssd1306_line(display, 1, 1, width - 2, 1, true);  // Topo
+    ssd1306_line(display, 1, 1, 1, height - 2, true); // Lateral
 
     // Realces
-    ssd1306_line(display, WIDTH - 1, 1, WIDTH - 1, HEIGHT - 1, false);  // Lateral direita
-    ssd1306_line(display, 1, HEIGHT - 1, WIDTH - 1, HEIGHT - 1, false); // Base
+    ssd1306_line(display, width - 1, 1, width - 1, height - 1, false);  // Lateral direita
+    ssd1306_line(display, 1, height - 1, width - 1, height - 1, false); // Base
 
     // Moldura principal
-    ssd1306_rect(display, 0, 0, WIDTH, HEIGHT, true, false);
+    ssd1306_rect(display, 0, 0, width, height, true, false);
     break;
 
   case 4: // Cantos arredondados
     // Linhas principais
-    ssd1306_line(display, 3, 0, WIDTH - 4, 0, true);                                   // Topo
-    ssd1306_line(display, 0, 3, 0, HEIGHT - 4, true);                                  // Lateral esquerda
-    ssd1306_line(display, WIDTH - 1, 3, WIDTH - 1, HEIGHT - 4, true);  // Lateral direita
-    ssd1306_line(display, 3, HEIGHT - 1, WIDTH - 4, HEIGHT - 1, true); // Base
+    ssd1306_line(display, 3, 0, width - 4, 0, true);                                   // Topo
+    ssd1306_line(display, 0, 3, 0, height - 4, true);                                  // Lateral esquerda
+    ssd1306_line(display, width - 1, 3, width - 1, height - 4, true);  // Lateral direita
+    ssd1306_line(display, 3, height - 1, width - 4, height - 1, true); // Base
 
     // Arredondamento dos cantos
     const uint8_t corners[12][2] = {{1, 1}, {0, 2}, {2, 0}, // Canto superior esquerdo
-                                    {WIDTH - 2, 0},
-                                    {WIDTH - 1, 1},
-                                    {WIDTH - 3, 0}, // Canto superior direito
-                                    {WIDTH - 1, HEIGHT - 2},
-                                    {WIDTH - 2, HEIGHT - 1},
-                                    {WIDTH - 3, HEIGHT - 1}, // Canto inferior direito
-                                    {1, HEIGHT - 1},
-                                    {0, HEIGHT - 2},
-                                    {2, HEIGHT - 1}}; // Canto inferior esquerdo
+                                    {width - 2, 0},
+                                    {width - 1, 1},
+                                    {width - 3, 0}, // Canto superior direito
+                                    {width - 1, height - 2},
+                                    {width - 2, height - 1},
+                                    {width - 3, height - 1}, // Canto inferior direito
+                                    {1, height - 1},
+                                    {0, height - 2},
+                                    {2, height - 1}}; // Canto inferior esquerdo
 
     for (uint8_t i = 0; i < 12; i++)
     {
@@ -270,27 +997,97 @@ void draw_border(ssd1306_t *display, uint8_t style)
   case 5: // Efeito de profundidade
     for (uint8_t i = 0; i < 3; i++)
     {
-      ssd1306_rect(display, i * 2, i * 2, WIDTH - (i * 4), HEIGHT - (i * 4), true, false);
+      ssd1306_rect(display, i * 2, i * 2, width - (i * 4), height - (i * 4), true, false);
     }
     break;
   }
 }
 
+static bool border_layer_fits(const ssd1306_t *display)
+{
+  return display->width == WIDTH && display->height == HEIGHT;
+}
+
+// Desenha borda estilizada no display (0-5 estilos), combinando (OR) a camada
+// pré-calculada com o conteúdo atual
+void draw_border(ssd1306_t *display, uint8_t style)
+{
+  if (!border_layer_fits(display))
+  {
+    draw_border_raster(display, style);
+    return;
+  }
+
+  style %= BORDER_LAYER_STYLES;
+  const uint8_t *layer = border_layers[style];
+  const uint16_t *offsets = border_layer_offsets[style];
+  uint8_t *buffer = display->ram_buffer + 1;
+  uint16_t first = BORDER_LAYER_SIZE, last = 0;
+  for (uint16_t n = 0; n < border_layer_offset_count[style]; ++n)
+  {
+    uint16_t i = offsets[n];
+    uint8_t combined = buffer[i] | layer[i];
+    if (combined != buffer[i])
+    {
+      buffer[i] = combined;
+      if (i < first)
+        first = i;
+      last = i;
+    }
+  }
+
+  // Marca as colunas alteradas; as páginas de uma coluna são consecutivas
+  if (first <= last)
+    ssd1306_mark_dirty(display, first / display->pages, 0, last / display->pages, display->height - 1);
+}
+
+// Substitui todo o quadro pela borda (equivale a ssd1306_fill(false) + draw_border)
+void draw_border_copy(ssd1306_t *display, uint8_t style)
+{
+  if (!border_layer_fits(display))
+  {
+    ssd1306_fill(display, false);
+    draw_border_raster(display, style);
+    return;
+  }
+
+  memcpy(display->ram_buffer + 1, border_layers[style % BORDER_LAYER_STYLES], BORDER_LAYER_SIZE);
+  ssd1306_mark_dirty(display, 0, 0, display->width - 1, display->height - 1);
+}
+
 // Função para desenhar uma string
+// O texto vem em UTF-8 e é proporcional: cada glyph ocupa só as suas colunas
+// acesas mais FONT_SPACING. A linha quebra quando o próximo glyph não cabe.
+// Os glyphs de uma mesma linha são copiados em sequência e a região alterada
+// é marcada uma única vez por linha
 void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y)
 {
-  while (*str)
+  static const uint8_t spacing[FONT_SPACING] = {0};
+  uint8_t line_start = x;
+  bool line_changed = false;
+  while (*str && y + FONT_LINE_HEIGHT <= ssd->height)
   {
-    ssd1306_draw_char(ssd, *str++, x, y);
-    x += 8;
-    if (x + 8 >= ssd->width)
+    const font_glyph_t *glyph = ssd1306_next_glyph(&str);
+    if (x + glyph->width > ssd->width)
     {
+      if (line_changed)
+        ssd1306_mark_dirty(ssd, line_start, y, x - 1, y + 7);
+      line_changed = false;
+      line_start = 0;
       x = 0;
-      y += 8;
+      y += FONT_LINE_HEIGHT;
+      if (y + FONT_LINE_HEIGHT > ssd->height)
+        break;
     }
-    if (y + 8 >= ssd->height)
+
+    line_changed |= ssd1306_blit_columns(ssd, glyph->columns + glyph->left, glyph->width, x, y);
+    x += glyph->width;
+    if (x + FONT_SPACING <= ssd->width)
     {
-      break;
+      line_changed |= ssd1306_blit_columns(ssd, spacing, FONT_SPACING, x, y);
+      x += FONT_SPACING;
     }
   }
+  if (line_changed)
+    ssd1306_mark_dirty(ssd, line_start, y, x - 1, y + 7);
 }
\ No newline at end of file
@@ -2,10 +2,22 @@
 #include "pico/stdlib.h"
 #include "hardware/i2c.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 #define WIDTH 128
 #define HEIGHT 64
 #define SQUARE_SIZE 8
 
+// Bytes do ram_buffer: um por coluna e página, mais o byte de controle 0x40
+#define SSD1306_BUFFER_SIZE(width, height) ((width) * ((height) / 8) + 1)
+
+// Entradas de 16 bits do buffer frontal do envio assíncrono: byte de controle
+// + 6 comandos de endereçamento antes do conteúdo do ram_buffer (no I2C; o
+// transporte SPI usa o mesmo buffer como bytes)
+#define SSD1306_DMA_BUFFER_SIZE(width, height) (7 + SSD1306_BUFFER_SIZE(width, height))
+
 typedef enum {
   SET_CONTRAST = 0x81,
   SET_ENTIRE_ON = 0xA4,
@@ -23,22 +35,121 @@ typedef enum {
   SET_DISP_CLK_DIV = 0xD5,
   SET_PRECHARGE = 0xD9,
   SET_VCOM_DESEL = 0xDB,
-  SET_CHARGE_PUMP = 0x8D
+  SET_CHARGE_PUMP = 0x8D,
+  SET_HSCROLL_RIGHT = 0x26,
+  SET_HSCROLL_LEFT = 0x27,
+  SET_VHSCROLL_RIGHT = 0x29,
+  SET_VHSCROLL_LEFT = 0x2A,
+  SET_VSCROLL_AREA = 0xA3,
+  SET_SCROLL_OFF = 0x2E,
+  SET_SCROLL_ON = 0x2F
 } ssd1306_command_t;
 
-typedef struct {
+// Intervalo entre passos da rolagem por hardware, em quadros do display
+// (códigos do datasheet, fora de ordem)
+typedef enum {
+  SSD1306_SCROLL_2_FRAMES = 0x07,
+  SSD1306_SCROLL_3_FRAMES = 0x04,
+  SSD1306_SCROLL_4_FRAMES = 0x05,
+  SSD1306_SCROLL_5_FRAMES = 0x00,
+  SSD1306_SCROLL_25_FRAMES = 0x06,
+  SSD1306_SCROLL_64_FRAMES = 0x01,
+  SSD1306_SCROLL_128_FRAMES = 0x02,
+  SSD1306_SCROLL_256_FRAMES = 0x03
+} ssd1306_scroll_interval_t;
+
+typedef struct ssd1306 ssd1306_t;
+typedef void (*ssd1306_flush_callback_t)(ssd1306_t *ssd);
+
+// Operações de envio ao controlador (I2C, SPI, simulado no PC...). Comandos e
+// dados chegam sem byte de controle; data[-1] é reservado ao transporte, que
+// pode usá-lo durante o envio (o I2C coloca ali o 0x40) e o restaura depois.
+// start_async e busy são opcionais: sem eles o display só envia bloqueando.
+// finish_async também: sem ele, a interrupção do DMA espera busy ficar falso
+// antes de chamar o callback do envio.
+typedef struct ssd1306_transport ssd1306_transport_t;
+struct ssd1306_transport {
+  void (*write_commands)(ssd1306_t *ssd, const uint8_t *commands, size_t count);
+  void (*write_data)(ssd1306_t *ssd, uint8_t *data, size_t count);
+  // Copia a janela do ram_buffer para o dma_buffer e dispara o DMA
+  void (*start_async)(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1);
+  bool (*busy)(ssd1306_t *ssd); // Envio assíncrono ainda em andamento
+  // Chamado na interrupção do DMA (último byte na FIFO do controlador), com
+  // ou sem callback; o transporte encerra o envio quando esse byte sair do
+  // barramento (STOP no I2C, CS no SPI) e chama o flush_callback, se houver
+  void (*finish_async)(ssd1306_t *ssd);
+};
+
+struct ssd1306 {
   uint8_t width, height, pages, address;
-  i2c_inst_t *i2c_port;
+  const ssd1306_transport_t *transport;
+  void *bus; // Contexto do transporte (i2c_inst_t, ssd1306_spi_t...); displays com o mesmo bus esperam uns aos outros
   bool external_vcc;
   uint8_t *ram_buffer;
   size_t bufsize;
-  uint8_t port_buffer[2];
-} ssd1306_t;
+  uint8_t dirty_x0, dirty_x1, dirty_page0, dirty_page1; // Região alterada desde o último envio (vazia se x0 > x1)
+  uint16_t *dma_buffer; // Buffer frontal: quadro em transmissão (no I2C, no formato do registrador IC_DATA_CMD)
+  int dma_channel;      // Canal DMA do envio assíncrono (-1 se não configurado)
+  ssd1306_flush_callback_t flush_callback;
+};
+
+// Sprite: bitmap que se move sobre o quadro. No modo BACKGROUND o conteúdo
+// sob o sprite é salvo ao desenhar e devolvido ao mover/esconder; no modo XOR
+// o mesmo desenho aplicado duas vezes se desfaz e nenhum fundo é guardado.
+typedef enum {
+  SSD1306_SPRITE_BACKGROUND,
+  SSD1306_SPRITE_XOR
+} ssd1306_sprite_mode_t;
+
+// Bytes do fundo salvo de um sprite de w x h pixels: com y fora do múltiplo
+// de 8 cada coluna ocupa até (h + 14) / 8 páginas
+#define SSD1306_SPRITE_BACKGROUND_SIZE(w, h) ((w) * (((h) + 14) / 8))
+
+typedef struct {
+  int16_t x, y;          // Posição atual (canto superior esquerdo)
+  uint8_t width, height;
+  const uint8_t *bitmap; // Colunas no formato do display, (height + 7) / 8 bytes por coluna; NULL = sólido
+  ssd1306_sprite_mode_t mode;
+  uint8_t *background;   // SSD1306_SPRITE_BACKGROUND_SIZE bytes (só no modo BACKGROUND)
+  bool visible;
+  int16_t min_x, max_x, min_y, max_y; // Limites aplicados às posições pedidas
+} ssd1306_sprite_t;
+
+extern const ssd1306_transport_t ssd1306_i2c_transport; // Padrão de ssd1306_init
+
+// Posição no ram_buffer do byte da coluna x na página informada (modo de
+// endereçamento vertical: as páginas de uma coluna ficam consecutivas)
+static inline uint16_t ssd1306_index(const ssd1306_t *ssd, uint8_t x, uint8_t page)
+{
+  return page + x * ssd->pages + 1;
+}
 
 void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c);
+void ssd1306_init_with_buffer(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address,
+                              i2c_inst_t *i2c, uint8_t *buffer);
+void ssd1306_set_transport(ssd1306_t *ssd, const ssd1306_transport_t *transport, void *bus);
 void ssd1306_config(ssd1306_t *ssd);
 void ssd1306_command(ssd1306_t *ssd, uint8_t command);
+void ssd1306_command_list(ssd1306_t *ssd, const uint8_t *commands, size_t count);
+void ssd1306_scroll_horizontal(ssd1306_t *ssd, bool left, uint8_t page0, uint8_t page1, ssd1306_scroll_interval_t interval);
+void ssd1306_scroll_diagonal(ssd1306_t *ssd, bool left, uint8_t page0, uint8_t page1, ssd1306_scroll_interval_t interval,
+                             uint8_t vertical_step);
+void ssd1306_set_vertical_scroll_area(ssd1306_t *ssd, uint8_t fixed_rows, uint8_t scroll_rows);
+void ssd1306_scroll_stop(ssd1306_t *ssd);
+void ssd1306_set_start_line(ssd1306_t *ssd, uint8_t line);
 void ssd1306_send_data(ssd1306_t *ssd);
+void ssd1306_send_dirty(ssd1306_t *ssd);
+void ssd1306_send_window(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1);
+void ssd1306_mark_dirty(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+void ssd1306_clear_dirty(ssd1306_t *ssd);
+bool ssd1306_async_init(ssd1306_t *ssd, ssd1306_flush_callback_t callback);
+bool ssd1306_async_init_with_buffer(ssd1306_t *ssd, ssd1306_flush_callback_t callback, uint16_t *buffer);
+void ssd1306_send_data_async(ssd1306_t *ssd);
+void ssd1306_send_dirty_async(ssd1306_t *ssd);
+void ssd1306_send_window_async(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1);
+void ssd1306_send_dirty_all(ssd1306_t *const *displays, size_t count);
+bool ssd1306_flush_busy(ssd1306_t *ssd);
+void ssd1306_wait_flush(ssd1306_t *ssd);
 
 void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value);
 void ssd1306_fill(ssd1306_t *ssd, bool value);
@@ -47,6 +158,23 @@ void ssd1306_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1
 void ssd1306_hline(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y, bool value);
 void ssd1306_vline(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value);
 void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y);
+bool ssd1306_blit_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y);
 void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y);
+uint16_t ssd1306_string_width(const char *str);
 void draw_border(ssd1306_t *display, uint8_t style);
-void draw_square(ssd1306_t *display, int x, int y);
\ No newline at end of file
+void draw_border_copy(ssd1306_t *display, uint8_t style);
+void draw_border_raster(ssd1306_t *display, uint8_t style);
+void draw_square(ssd1306_t *display, int x, int y);
+
+void ssd1306_sprite_init(ssd1306_sprite_t *sprite, uint8_t width, uint8_t height, const uint8_t *bitmap,
+                         ssd1306_sprite_mode_t mode, uint8_t *background);
+void ssd1306_sprite_set_bounds(ssd1306_sprite_t *sprite, int16_t min_x, int16_t max_x, int16_t min_y, int16_t max_y);
+void ssd1306_sprite_clamp(const ssd1306_sprite_t *sprite, int16_t *x, int16_t *y);
+void ssd1306_sprite_move(ssd1306_t *ssd, ssd1306_sprite_t *sprite, int16_t x, int16_t y);
+void ssd1306_sprite_hide(ssd1306_t *ssd, ssd1306_sprite_t *sprite);
+void ssd1306_sprite_invalidate(ssd1306_sprite_t *sprite);
+void ssd1306_sprite_stamp(ssd1306_t *ssd, const ssd1306_sprite_t *sprite, int16_t x, int16_t y);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,140 @@
+// Display SSD1306 com as dimensões fixadas em tempo de compilação.
+//
+// Envolve a API em C (ssd1306.h) com o framebuffer dentro do próprio objeto,
+// sem calloc: uma instância global fica inteira na .bss. Como a largura e o
+// número de páginas são constantes, o índice de cada pixel vira um
+// deslocamento e, com coordenadas conhecidas na compilação (set<X, Y>()), o
+// acesso se reduz a um load/OR/store no endereço final, sem testes de limite.
+//
+// Inclua este cabeçalho no lugar de ssd1306.h (que não tem proteção contra
+// inclusão dupla).
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "ssd1306.h"
+
+template <uint8_t W, uint8_t H>
+class Ssd1306
+{
+  static_assert(W > 0 && W <= 128, "o SSD1306 tem no máximo 128 colunas");
+  static_assert(H > 0 && H <= 64 && H % 8 == 0, "a altura deve ser múltipla de 8, até 64 linhas");
+
+public:
+  static constexpr uint8_t width = W;
+  static constexpr uint8_t height = H;
+  static constexpr uint8_t pages = H / 8;
+  static constexpr size_t buffer_size = SSD1306_BUFFER_SIZE(W, H);
+  static constexpr size_t dma_buffer_size = SSD1306_DMA_BUFFER_SIZE(W, H);
+
+  // O ssd1306_t interno aponta para o buffer_ deste objeto: uma cópia
+  // apontaria para o buffer do original (e ficaria pendurada quando ele
+  // sumisse), então a classe não é copiável
+  Ssd1306() = default;
+  Ssd1306(const Ssd1306 &) = delete;
+  Ssd1306 &operator=(const Ssd1306 &) = delete;
+
+  // Mesma conta de ssd1306_index, com o número de páginas constante
+  static constexpr uint16_t index(uint8_t x, uint8_t y)
+  {
+    return (y >> 3) + x * pages + 1;
+  }
+
+  static constexpr uint8_t mask(uint8_t y)
+  {
+    return static_cast<uint8_t>(1u << (y & 7));
+  }
+
+  // Não toca no hardware: pode ser chamada antes do i2c_init, como ssd1306_init
+  void init(bool external_vcc, uint8_t address, i2c_inst_t *i2c)
+  {
+    ssd1306_init_with_buffer(&ssd_, W, H, external_vcc, address, i2c, buffer_);
+  }
+
+  // O buffer frontal do DMA fica com o chamador (estático), já que nem todo
+  // display usa envio assíncrono
+  bool async_init(ssd1306_flush_callback_t callback, uint16_t (&dma_buffer)[dma_buffer_size])
+  {
+    return ssd1306_async_init_with_buffer(&ssd_, callback, dma_buffer);
+  }
+
+  // Pixel em posição constante: índice, máscara e região alterada são
+  // resolvidos na compilação
+  template <uint8_t X, uint8_t Y>
+  void set(bool value)
+  {
+    static_assert(X < W && Y < H, "pixel fora da tela");
+    constexpr uint16_t i = index(X, Y);
+    constexpr uint8_t m = mask(Y);
+    write(i, value ? (buffer_[i] | m) : (buffer_[i] & static_cast<uint8_t>(~m)), X, Y >> 3);
+  }
+
+  template <uint8_t X, uint8_t Y>
+  bool get() const
+  {
+    static_assert(X < W && Y < H, "pixel fora da tela");
+    return buffer_[index(X, Y)] & mask(Y);
+  }
+
+  // Pixel em posição variável; fora da tela é ignorado
+  void pixel(uint8_t x, uint8_t y, bool value)
+  {
+    if (x >= W || y >= H)
+      return;
+    uint16_t i = index(x, y);
+    uint8_t m = mask(y);
+    write(i, value ? (buffer_[i] | m) : (buffer_[i] & static_cast<uint8_t>(~m)), x, y >> 3);
+  }
+
+  bool get(uint8_t x, uint8_t y) const
+  {
+    return x < W && y < H && (buffer_[index(x, y)] & mask(y));
+  }
+
+  void config() { ssd1306_config(&ssd_); }
+  void send_data() { ssd1306_send_data(&ssd_); }
+  void send_dirty() { ssd1306_send_dirty(&ssd_); }
+  void send_dirty_async() { ssd1306_send_dirty_async(&ssd_); }
+  void wait_flush() { ssd1306_wait_flush(&ssd_); }
+  bool flush_busy() { return ssd1306_flush_busy(&ssd_); }
+
+  void fill(bool value) { ssd1306_fill(&ssd_, value); }
+  void rect(uint8_t top, uint8_t left, uint8_t w, uint8_t h, bool value, bool filled)
+  {
+    ssd1306_rect(&ssd_, top, left, w, h, value, filled);
+  }
+  void line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, bool value) { ssd1306_line(&ssd_, x0, y0, x1, y1, value); }
+  void hline(uint8_t x0, uint8_t x1, uint8_t y, bool value) { ssd1306_hline(&ssd_, x0, x1, y, value); }
+  void vline(uint8_t x, uint8_t y0, uint8_t y1, bool value) { ssd1306_vline(&ssd_, x, y0, y1, value); }
+  void draw_char(char c, uint8_t x, uint8_t y) { ssd1306_draw_char(&ssd_, c, x, y); }
+  void draw_string(const char *str, uint8_t x, uint8_t y) { ssd1306_draw_string(&ssd_, str, x, y); }
+  static uint16_t string_width(const char *str) { return ssd1306_string_width(str); }
+
+  const uint8_t *buffer() const { return buffer_; }
+
+  // Acesso à estrutura em C, para as funções sem equivalente aqui
+  // (bordas, sprites, rolagem, ssd1306_send_dirty_all)
+  ssd1306_t *handle() { return &ssd_; }
+  const ssd1306_t *handle() const { return &ssd_; }
+
+private:
+  // Equivalente a ssd1306_pixel + ssd1306_mark_dirty: só escreve e marca a
+  // região quando o byte muda
+  void write(uint16_t i, uint8_t byte, uint8_t x, uint8_t page)
+  {
+    if (byte == buffer_[i])
+      return;
+    buffer_[i] = byte;
+    if (x < ssd_.dirty_x0)
+      ssd_.dirty_x0 = x;
+    if (x > ssd_.dirty_x1)
+      ssd_.dirty_x1 = x;
+    if (page < ssd_.dirty_page0)
+      ssd_.dirty_page0 = page;
+    if (page > ssd_.dirty_page1)
+      ssd_.dirty_page1 = page;
+  }
+
+  ssd1306_t ssd_;
+  uint8_t buffer_[buffer_size];
+};
@@ -0,0 +1,255 @@
+#include "ssd1306.h"
+#include "ssd1306_gray.h"
+
+// Plano mostrado em cada fatia: o de peso 2 fica na tela o dobro do tempo
+static const uint8_t slice_plane[SSD1306_GRAY_SLICES] = {1, 0, 1};
+
+static void ssd1306_gray_clear_update(ssd1306_gray_t *gray)
+{
+  gray->update.x0 = 0xFF;
+  gray->update.x1 = 0;
+  gray->update.page0 = 0xFF;
+  gray->update.page1 = 0;
+}
+
+// Os planos têm o formato do ram_buffer (bufsize bytes, com o byte de
+// controle na frente) e começam apagados
+void ssd1306_gray_init(ssd1306_gray_t *gray, ssd1306_t *display, uint8_t *plane0, uint8_t *plane1)
+{
+  uint8_t *buffers[2] = {plane0, plane1};
+  gray->display = display;
+  for (uint8_t i = 0; i < 2; ++i)
+  {
+    gray->plane[i] = *display;
+    gray->plane[i].ram_buffer = buffers[i];
+    buffers[i][0] = 0x40;
+    ssd1306_fill(&gray->plane[i], false);
+  }
+  gray->span_count = 0;
+  gray->slice = 0;
+  gray->next_span = 0;
+  gray->planes_shown = 0;
+  ssd1306_gray_clear_update(gray);
+}
+
+void ssd1306_gray_fill(ssd1306_gray_t *gray, uint8_t level)
+{
+  ssd1306_fill(&gray->plane[0], level & 1);
+  ssd1306_fill(&gray->plane[1], level & 2);
+}
+
+void ssd1306_gray_pixel(ssd1306_gray_t *gray, uint8_t x, uint8_t y, uint8_t level)
+{
+  ssd1306_pixel(&gray->plane[0], x, y, level & 1);
+  ssd1306_pixel(&gray->plane[1], x, y, level & 2);
+}
+
+void ssd1306_gray_rect(ssd1306_gray_t *gray, uint8_t top, uint8_t left, uint8_t width, uint8_t height, uint8_t level,
+                       bool fill)
+{
+  ssd1306_rect(&gray->plane[0], top, left, width, height, level & 1, fill);
+  ssd1306_rect(&gray->plane[1], top, left, width, height, level & 2, fill);
+}
+
+void ssd1306_gray_line(ssd1306_gray_t *gray, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t level)
+{
+  ssd1306_line(&gray->plane[0], x0, y0, x1, y1, level & 1);
+  ssd1306_line(&gray->plane[1], x0, y0, x1, y1, level & 2);
+}
+
+// Bordas em tons de cinza (0-5 estilos). O efeito 3D e o de profundidade
+// ganham sombreamento de verdade; os demais estilos ficam no nível 3, como
+// em draw_border_raster.
+void ssd1306_gray_border(ssd1306_gray_t *gray, uint8_t style)
+{
+  const uint8_t width = gray->display->width;
+  const uint8_t height = gray->display->height;
+
+  ssd1306_gray_fill(gray, 0);
+  switch (style % 6)
+  {
+  case 3: // Efeito tridimensional: luz no topo e à esquerda, sombra embaixo e à direita
+    ssd1306_gray_rect(gray, 0, 0, width, height, 3, false);
+    ssd1306_gray_line(gray, 1, 1, width - 2, 1, 2);
+    ssd1306_gray_line(gray, 1, 1, 1, height - 2, 2);
+    ssd1306_gray_line(gray, 2, height - 2, width - 2, height - 2, 1);
+    ssd1306_gray_line(gray, width - 2, 2, width - 2, height - 2, 1);
+    break;
+
+  case 5: // Efeito de profundidade: molduras mais apagadas para fora
+    for (uint8_t i = 0; i < 3; i++)
+    {
+      ssd1306_gray_rect(gray, i * 2, i * 2, width - (i * 4), height - (i * 4), i + 1, false);
+    }
+    break;
+
+  default:
+    draw_border_raster(&gray->plane[0], style);
+    draw_border_raster(&gray->plane[1], style);
+    break;
+  }
+}
+
+// Guarda um trecho e amplia o retângulo que contém todos. Retorna false se
+// a lista está cheia.
+static bool ssd1306_gray_add_span(ssd1306_gray_t *gray, ssd1306_gray_span_t *bounds, uint8_t x0, uint8_t x1,
+                                  uint8_t page)
+{
+  if (x0 < bounds->x0)
+    bounds->x0 = x0;
+  if (x1 > bounds->x1)
+    bounds->x1 = x1;
+  if (page < bounds->page0)
+    bounds->page0 = page;
+  bounds->page1 = page;
+
+  if (gray->span_count == SSD1306_GRAY_MAX_SPANS)
+    return false;
+  gray->spans[gray->span_count++] = (ssd1306_gray_span_t){x0, x1, page, page};
+  return true;
+}
+
+// Procura, página por página, as colunas em que os planos diferem. Se não
+// couberem em SSD1306_GRAY_MAX_SPANS trechos, a fatia envia o retângulo que
+// contém todas elas. A fatia em andamento recomeça pelo primeiro trecho novo:
+// os índices dos antigos não valem mais.
+static void ssd1306_gray_find_spans(ssd1306_gray_t *gray)
+{
+  const ssd1306_t *layout = &gray->plane[0];
+  const uint8_t *a = gray->plane[0].ram_buffer;
+  const uint8_t *b = gray->plane[1].ram_buffer;
+  ssd1306_gray_span_t bounds = {0xFF, 0, 0xFF, 0};
+  bool fits = true;
+
+  gray->span_count = 0;
+  gray->next_span = 0;
+  for (uint8_t page = 0; page < layout->pages; ++page)
+  {
+    int16_t start = -1, last = -1;
+    for (uint8_t x = 0; x < layout->width; ++x)
+    {
+      uint16_t i = ssd1306_index(layout, x, page);
+      if (a[i] == b[i])
+        continue;
+      if (start >= 0 && x - last - 1 >= SSD1306_GRAY_SPAN_GAP)
+      {
+        fits &= ssd1306_gray_add_span(gray, &bounds, start, last, page);
+        start = -1;
+      }
+      if (start < 0)
+        start = x;
+      last = x;
+    }
+    if (start >= 0)
+      fits &= ssd1306_gray_add_span(gray, &bounds, start, last, page);
+  }
+
+  if (!fits)
+  {
+    gray->spans[0] = bounds;
+    gray->span_count = 1;
+  }
+}
+
+// Fecha o quadro desenhado nos planos: a região alterada vai na próxima
+// fatia e os trechos de cinza são recalculados
+void ssd1306_gray_present(ssd1306_gray_t *gray)
+{
+  bool changed = false;
+  for (uint8_t i = 0; i < 2; ++i)
+  {
+    ssd1306_t *plane = &gray->plane[i];
+    uint8_t x1 = (plane->dirty_x1 < plane->width) ? plane->dirty_x1 : plane->width - 1;
+    uint8_t page1 = (plane->dirty_page1 < plane->pages) ? plane->dirty_page1 : plane->pages - 1;
+    if (plane->dirty_x0 <= x1 && plane->dirty_page0 <= page1)
+    {
+      if (plane->dirty_x0 < gray->update.x0)
+        gray->update.x0 = plane->dirty_x0;
+      if (x1 > gray->update.x1)
+        gray->update.x1 = x1;
+      if (plane->dirty_page0 < gray->update.page0)
+        gray->update.page0 = plane->dirty_page0;
+      if (page1 > gray->update.page1)
+        gray->update.page1 = page1;
+      changed = true;
+    }
+    ssd1306_clear_dirty(plane);
+  }
+
+  if (changed)
+    ssd1306_gray_find_spans(gray);
+}
+
+// Dispara o próximo envio (região alterada ou trecho da fatia) se o
+// barramento estiver livre. Retorna false se não havia o que enviar agora:
+// envio em andamento, fatia já toda enviada ou imagem sem cinza. A fatia só
+// avança com ssd1306_gray_next_slice, para quem chama controlar quanto tempo
+// cada uma fica na tela.
+bool ssd1306_gray_poll(ssd1306_gray_t *gray)
+{
+  ssd1306_t *display = gray->display;
+  if (ssd1306_flush_busy(display))
+    return false;
+
+  ssd1306_gray_span_t span;
+  if (gray->update.x0 <= gray->update.x1)
+  {
+    span = gray->update;
+    ssd1306_gray_clear_update(gray);
+  }
+  else
+  {
+    if (gray->next_span >= gray->span_count)
+      return false;
+    span = gray->spans[gray->next_span++];
+  }
+
+  // O envio lê o plano da fatia no lugar do ram_buffer (o assíncrono já o
+  // copiou para o dma_buffer quando a função retorna)
+  uint8_t *frame = display->ram_buffer;
+  display->ram_buffer = gray->plane[slice_plane[gray->slice]].ram_buffer;
+  ssd1306_send_window_async(display, span.x0, span.x1, span.page0, span.page1);
+  display->ram_buffer = frame;
+  return true;
+}
+
+void ssd1306_gray_next_slice(ssd1306_gray_t *gray)
+{
+  gray->planes_shown++;
+  gray->slice = (gray->slice + 1) % SSD1306_GRAY_SLICES;
+  gray->next_span = 0;
+}
+
+// Alterna os planos até SSD1306_GRAY_GUARD_US antes do prazo (o do próximo
+// quadro do frame_scheduler). O tempo é dividido em fatias iguais, em ciclos
+// inteiros: cada fatia envia seus trechos e espera o próprio fim, então o
+// plano 1, em duas de cada três, fica 2/3 do tempo na tela, o peso do seu
+// bit, mesmo que o envio seja bem mais curto que a fatia. Sem cinza na tela
+// retorna depois de enviar a região alterada.
+void ssd1306_gray_run_until(ssd1306_gray_t *gray, absolute_time_t deadline)
+{
+  absolute_time_t start = get_absolute_time();
+  int64_t budget_us = absolute_time_diff_us(start, deadline) - SSD1306_GRAY_GUARD_US;
+  if (budget_us <= 0)
+    return;
+  absolute_time_t stop = delayed_by_us(start, budget_us);
+
+  uint32_t cycles = budget_us / (SSD1306_GRAY_SLICES * SSD1306_GRAY_MIN_SLICE_US);
+  uint32_t slices = (cycles ? cycles : 1) * SSD1306_GRAY_SLICES;
+  for (uint32_t n = 1; n <= slices; ++n)
+  {
+    while (ssd1306_gray_poll(gray) || ssd1306_flush_busy(gray->display))
+    {
+      if (time_reached(stop))
+        return; // Envio mais longo que o quadro: a fatia continua na próxima chamada
+      tight_loop_contents();
+    }
+    if (!gray->span_count)
+      return;
+
+    absolute_time_t slice_end = delayed_by_us(start, budget_us * n / slices);
+    while (!best_effort_wfe_or_timeout(slice_end))
+      tight_loop_contents();
+    ssd1306_gray_next_slice(gray);
+  }
+}
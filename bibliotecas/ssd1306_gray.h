@@ -0,0 +1,52 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include "pico/stdlib.h"
+
+typedef struct ssd1306 ssd1306_t; // bibliotecas/ssd1306.h
+
+// Tons de cinza por modulação temporal: cada pixel tem 2 bits em dois planos
+// monocromáticos, e o display alterna entre eles em fatias de tempo iguais,
+// com o plano 1 (peso 2) em duas de cada três fatias. O olho integra os
+// níveis 0 (apagado), 1, 2 e 3 (aceso).
+#define SSD1306_GRAY_LEVELS 4
+#define SSD1306_GRAY_SLICES 3
+
+// ssd1306_gray_run_until divide o tempo até o prazo em ciclos inteiros de
+// fatias com pelo menos SSD1306_GRAY_MIN_SLICE_US cada, e termina
+// SSD1306_GRAY_GUARD_US antes do prazo para o quadro não contar como perdido
+#define SSD1306_GRAY_MIN_SLICE_US 2000
+#define SSD1306_GRAY_GUARD_US 500
+
+// Só os bytes que diferem entre os planos (níveis 1 e 2) mudam de uma fatia
+// para outra, então cada fatia reenvia apenas esses trechos, linha de página
+// por linha de página. Trechos separados por menos colunas que isso viram um
+// só, já que cada janela custa alguns bytes de comando.
+#define SSD1306_GRAY_SPAN_GAP 8
+#define SSD1306_GRAY_MAX_SPANS 48
+
+typedef struct {
+  uint8_t x0, x1, page0, page1;
+} ssd1306_gray_span_t;
+
+typedef struct {
+  ssd1306_t *display;         // Transporte, DMA e GDDRAM
+  ssd1306_t plane[2];         // Visões para desenhar com a API monocromática: plano 0 (peso 1) e plano 1 (peso 2)
+  ssd1306_gray_span_t spans[SSD1306_GRAY_MAX_SPANS]; // Trechos onde os planos diferem
+  uint8_t span_count;
+  uint8_t slice;              // Fatia em envio
+  uint8_t next_span;          // Próximo trecho da fatia
+  ssd1306_gray_span_t update; // Região alterada pelo último quadro, ainda não enviada (vazia se x0 > x1)
+  uint32_t planes_shown;      // Fatias completas
+} ssd1306_gray_t;
+
+void ssd1306_gray_init(ssd1306_gray_t *gray, ssd1306_t *display, uint8_t *plane0, uint8_t *plane1);
+void ssd1306_gray_fill(ssd1306_gray_t *gray, uint8_t level);
+void ssd1306_gray_pixel(ssd1306_gray_t *gray, uint8_t x, uint8_t y, uint8_t level);
+void ssd1306_gray_rect(ssd1306_gray_t *gray, uint8_t top, uint8_t left, uint8_t width, uint8_t height, uint8_t level,
+                       bool fill);
+void ssd1306_gray_line(ssd1306_gray_t *gray, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t level);
+void ssd1306_gray_border(ssd1306_gray_t *gray, uint8_t style);
+void ssd1306_gray_present(ssd1306_gray_t *gray);
+bool ssd1306_gray_poll(ssd1306_gray_t *gray);
+void ssd1306_gray_next_slice(ssd1306_gray_t *gray);
+void ssd1306_gray_run_until(ssd1306_gray_t *gray, absolute_time_t deadline);
@@ -0,0 +1,121 @@
+#include "ssd1306.h"
+#include "ssd1306_spi.h"
+#include "hardware/dma.h"
+
+static void spi_write_commands(ssd1306_t *ssd, const uint8_t *commands, size_t count);
+static void spi_write_data(ssd1306_t *ssd, uint8_t *data, size_t count);
+static void spi_start_async(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1);
+static bool spi_busy(ssd1306_t *ssd);
+static void spi_finish_async(ssd1306_t *ssd);
+
+const ssd1306_transport_t ssd1306_spi_transport = {
+    .write_commands = spi_write_commands,
+    .write_data = spi_write_data,
+    .start_async = spi_start_async,
+    .busy = spi_busy,
+    .finish_async = spi_finish_async,
+};
+
+// Contexto com um envio assíncrono em andamento (CS baixo) em cada
+// controlador, até spi_finish_async. Displays com contextos diferentes no
+// mesmo controlador esperam por ele antes de baixar o próprio CS.
+static ssd1306_spi_t *volatile spi_sending[NUM_SPIS];
+
+static void spi_wait_controller(ssd1306_spi_t *context)
+{
+  while (spi_sending[spi_get_index(context->spi)])
+    tight_loop_contents();
+}
+
+void ssd1306_spi_attach(ssd1306_t *ssd, ssd1306_spi_t *context, spi_inst_t *spi, uint8_t dc_pin, uint8_t cs_pin)
+{
+  context->spi = spi;
+  context->dc_pin = dc_pin;
+  context->cs_pin = cs_pin;
+
+  gpio_init(cs_pin);
+  gpio_set_dir(cs_pin, GPIO_OUT);
+  gpio_put(cs_pin, 1);
+  gpio_init(dc_pin);
+  gpio_set_dir(dc_pin, GPIO_OUT);
+
+  ssd1306_set_transport(ssd, &ssd1306_spi_transport, context);
+}
+
+// No SPI não há byte de controle: o pino D/C diz se os bytes são comandos (0)
+// ou dados da GDDRAM (1). spi_write_blocking só retorna depois do último bit,
+// então o CS pode subir logo em seguida.
+static void spi_write(ssd1306_t *ssd, bool data, const uint8_t *bytes, size_t count)
+{
+  ssd1306_spi_t *context = ssd->bus;
+  spi_wait_controller(context);
+  gpio_put(context->dc_pin, data);
+  gpio_put(context->cs_pin, 0);
+  spi_write_blocking(context->spi, bytes, count);
+  gpio_put(context->cs_pin, 1);
+}
+
+static void spi_write_commands(ssd1306_t *ssd, const uint8_t *commands, size_t count)
+{
+  spi_write(ssd, false, commands, count);
+}
+
+static void spi_write_data(ssd1306_t *ssd, uint8_t *data, size_t count)
+{
+  spi_write(ssd, true, data, count);
+}
+
+// A janela vai bloqueando (6 bytes, alguns microssegundos) e só os dados
+// passam pelo DMA, um byte por transferência, usando o dma_buffer como bytes.
+// O CS fica baixo até spi_finish_async, na interrupção do fim do DMA.
+static void spi_start_async(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1)
+{
+  const uint8_t window[] = {SET_COL_ADDR, x0, x1, SET_PAGE_ADDR, page0, page1};
+  spi_write(ssd, false, window, sizeof(window));
+
+  uint8_t *start = (uint8_t *)ssd->dma_buffer;
+  uint8_t *out = start;
+  for (uint16_t x = x0; x <= x1; ++x)
+  {
+    for (uint8_t page = page0; page <= page1; ++page)
+      *out++ = ssd->ram_buffer[ssd1306_index(ssd, x, page)];
+  }
+
+  ssd1306_spi_t *context = ssd->bus;
+  spi_inst_t *spi = context->spi;
+  spi_sending[spi_get_index(spi)] = context;
+  gpio_put(context->dc_pin, 1);
+  gpio_put(context->cs_pin, 0);
+
+  dma_channel_config config = dma_channel_get_default_config(ssd->dma_channel);
+  channel_config_set_transfer_data_size(&config, DMA_SIZE_8);
+  channel_config_set_read_increment(&config, true);
+  channel_config_set_write_increment(&config, false);
+  channel_config_set_dreq(&config, spi_get_dreq(spi, true));
+  dma_channel_configure(ssd->dma_channel, &config, &spi_get_hw(spi)->dr, start, out - start, true);
+}
+
+// Só consulta: quem encerra o envio é spi_finish_async
+static bool spi_busy(ssd1306_t *ssd)
+{
+  ssd1306_spi_t *context = ssd->bus;
+  return spi_sending[spi_get_index(context->spi)] == context;
+}
+
+// Fim do DMA: o último byte entrou na FIFO, mas BSY continua ligado até ele
+// sair pelo MOSI (no máximo 8 bytes, ~6 us a 10 MHz, curto o bastante para
+// esperar aqui mesmo). Sobe o CS e chama o callback, como o STOP final no
+// I2C, sem depender de alguém chamar spi_busy.
+static void spi_finish_async(ssd1306_t *ssd)
+{
+  ssd1306_spi_t *context = ssd->bus;
+  while (spi_is_busy(context->spi))
+    tight_loop_contents();
+
+  // Os bytes recebidos durante o DMA transbordam a FIFO RX; o próximo
+  // spi_write_blocking a esvazia e limpa o erro
+  gpio_put(context->cs_pin, 1);
+  spi_sending[spi_get_index(context->spi)] = NULL;
+  if (ssd->flush_callback)
+    ssd->flush_callback(ssd);
+}
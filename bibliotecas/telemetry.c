@@ -0,0 +1,95 @@
+#include <string.h>
+#include "telemetry.h"
+
+void telemetry_init(telemetry_t *telemetry, uint32_t min_interval_us)
+{
+  memset(telemetry, 0, sizeof(*telemetry));
+  atomic_init(&telemetry->head, 0);
+  atomic_init(&telemetry->tail, 0);
+  telemetry->min_interval_us = min_interval_us;
+}
+
+// Produtor: enfileira um registro. Retorna false se ele foi descartado pelo
+// limite de taxa ou porque o anel está cheio (contados separadamente).
+bool telemetry_log(telemetry_t *telemetry, const telemetry_record_t *record)
+{
+  if (telemetry->has_last && record->timestamp_us - telemetry->last_timestamp_us < telemetry->min_interval_us)
+  {
+    telemetry->dropped_rate++;
+    return false;
+  }
+
+  unsigned head = atomic_load_explicit(&telemetry->head, memory_order_relaxed);
+  unsigned tail = atomic_load_explicit(&telemetry->tail, memory_order_acquire);
+  if (head - tail == TELEMETRY_CAPACITY)
+  {
+    telemetry->dropped_full++;
+    return false;
+  }
+
+  telemetry->records[head % TELEMETRY_CAPACITY] = *record;
+  atomic_store_explicit(&telemetry->head, head + 1, memory_order_release);
+  telemetry->last_timestamp_us = record->timestamp_us;
+  telemetry->has_last = true;
+  return true;
+}
+
+static void put_u16(uint8_t *out, uint16_t value)
+{
+  out[0] = value & 0xFF;
+  out[1] = value >> 8;
+}
+
+static void telemetry_encode(telemetry_t *telemetry, const telemetry_record_t *record)
+{
+  uint8_t *out = telemetry->pending;
+
+  out[0] = TELEMETRY_MAGIC;
+  out[1] = telemetry->sequence++;
+  put_u16(&out[2], record->timestamp_us & 0xFFFF);
+  put_u16(&out[4], record->timestamp_us >> 16);
+  put_u16(&out[6], record->adc_x);
+  put_u16(&out[8], record->adc_y);
+  put_u16(&out[10], record->pwm_red);
+  put_u16(&out[12], record->pwm_blue);
+  out[14] = record->border_style;
+  out[15] = record->flags;
+  put_u16(&out[16], (uint16_t)telemetry->dropped_full);
+  put_u16(&out[18], (uint16_t)telemetry->dropped_rate);
+
+  uint8_t checksum = 0;
+  for (uint8_t i = 0; i < TELEMETRY_FRAME_SIZE - 1; ++i)
+    checksum ^= out[i];
+  out[TELEMETRY_FRAME_SIZE - 1] = checksum;
+
+  telemetry->pending_offset = 0;
+  telemetry->pending_size = TELEMETRY_FRAME_SIZE;
+}
+
+// Consumidor: serializa e envia registros enquanto a saída aceitar bytes.
+// Um quadro cortado no meio continua de onde parou na próxima chamada.
+// Retorna quantos bytes foram entregues.
+size_t telemetry_drain(telemetry_t *telemetry, telemetry_write_fn write, void *context)
+{
+  size_t total = 0;
+  while (true)
+  {
+    if (telemetry->pending_offset == telemetry->pending_size)
+    {
+      unsigned tail = atomic_load_explicit(&telemetry->tail, memory_order_relaxed);
+      unsigned head = atomic_load_explicit(&telemetry->head, memory_order_acquire);
+      if (head == tail)
+        return total; // Nada para enviar
+
+      telemetry_encode(telemetry, &telemetry->records[tail % TELEMETRY_CAPACITY]);
+      atomic_store_explicit(&telemetry->tail, tail + 1, memory_order_release);
+    }
+
+    size_t remaining = telemetry->pending_size - telemetry->pending_offset;
+    size_t written = write(context, &telemetry->pending[telemetry->pending_offset], remaining);
+    telemetry->pending_offset += written;
+    total += written;
+    if (written < remaining)
+      return total; // Saída cheia
+  }
+}
@@ -0,0 +1,55 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdatomic.h>
+
+// Capacidade do anel de registros (potência de 2)
+#define TELEMETRY_CAPACITY 32
+
+// Quadro serializado (little-endian), decodificado por host/decode_telemetry.py:
+//   0     0xA5 (início de quadro)
+//   1     sequência (incrementa a cada quadro enviado)
+//   2-5   timestamp_us
+//   6-7   adc_x        8-9   adc_y
+//   10-11 pwm_red      12-13 pwm_blue
+//   14    border_style 15    flags (TELEMETRY_FLAG_*)
+//   16-17 registros descartados com o anel cheio (dropped_full, 16 bits)
+//   18-19 registros descartados pelo limite de taxa (dropped_rate, 16 bits)
+//   20    XOR dos bytes 0-19
+#define TELEMETRY_MAGIC 0xA5
+#define TELEMETRY_FRAME_SIZE 21
+
+#define TELEMETRY_FLAG_PWM_ENABLED 0x01
+#define TELEMETRY_FLAG_LED_GREEN 0x02
+
+typedef struct {
+  uint32_t timestamp_us;
+  uint16_t adc_x, adc_y;
+  uint16_t pwm_red, pwm_blue;
+  uint8_t border_style;
+  uint8_t flags;
+} telemetry_record_t;
+
+// Recebe até len bytes sem bloquear e retorna quantos aceitou
+typedef size_t (*telemetry_write_fn)(void *context, const uint8_t *data, size_t len);
+
+// Logger lock-free de um produtor (telemetry_log) e um consumidor
+// (telemetry_drain). O caminho quente só copia um registro de tamanho fixo;
+// a serialização e o envio ficam no drain, que para quando a saída enche.
+typedef struct {
+  telemetry_record_t records[TELEMETRY_CAPACITY];
+  atomic_uint head;
+  atomic_uint tail;
+  uint32_t min_interval_us;   // Limite de taxa (0 = sem limite)
+  uint32_t last_timestamp_us; // Último registro aceito
+  bool has_last;
+  uint32_t dropped_full;      // Descartados com o anel cheio
+  uint32_t dropped_rate;      // Descartados pelo limite de taxa
+  uint8_t sequence;
+  uint8_t pending[TELEMETRY_FRAME_SIZE]; // Quadro parcialmente enviado
+  uint8_t pending_offset, pending_size;
+} telemetry_t;
+
+void telemetry_init(telemetry_t *telemetry, uint32_t min_interval_us);
+bool telemetry_log(telemetry_t *telemetry, const telemetry_record_t *record);
+size_t telemetry_drain(telemetry_t *telemetry, telemetry_write_fn write, void *context);
@@ -0,0 +1,31 @@
+// Animação de exemplo para o benchmark: bola quicando em quadros de 32x16 (host/bench_animation.txt)
+//   python3 "Criar letras e animações via priskel.py" --animacao host/bench_animation.txt --nome bench_animation > host/bench_animation.h
+// Gerado por "Criar letras e animações via priskel.py" --animacao: 1024 bytes de quadros em 407
+static const uint8_t bench_animation[] = {
+    0x41, 0x4e, 0x20, 0x02, 0x10, 0x00, 0x64, 0x00, 0x01, 0x41, 0x00, 0x3f, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x98, 0x00, 0xbc, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xbc, 0x00, 0x98, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x12, 0x00, 0x84,
+    0x00, 0x0c, 0x18, 0x00, 0x3f, 0x80, 0x79, 0xc0, 0x71, 0xc0, 0x33, 0x80, 0x1f, 0x00, 0x03, 0xad,
+    0x00, 0x00, 0x13, 0x00, 0x86, 0x00, 0x0d, 0x03, 0x80, 0x07, 0x00, 0x0f, 0x20, 0x0e, 0x70, 0x04,
+    0xf0, 0x00, 0xe0, 0x01, 0xc0, 0xaa, 0x00, 0x00, 0x12, 0x00, 0x89, 0x00, 0x0c, 0xc0, 0x00, 0x80,
+    0x01, 0x00, 0x03, 0x08, 0x02, 0x18, 0x00, 0x30, 0x00, 0x60, 0xa8, 0x00, 0x00, 0x14, 0x00, 0x8b,
+    0x00, 0x0e, 0x60, 0x00, 0xf0, 0x00, 0x38, 0x01, 0x18, 0x00, 0x00, 0x03, 0x90, 0x03, 0xe0, 0x01,
+    0xc0, 0xa4, 0x00, 0x00, 0x15, 0x00, 0x8f, 0x00, 0x0f, 0xc0, 0x00, 0xe0, 0x01, 0xf0, 0x00, 0x70,
+    0x04, 0x20, 0x0e, 0x00, 0x0f, 0x80, 0x07, 0x00, 0x03, 0x9f, 0x00, 0x00, 0x12, 0x00, 0x94, 0x00,
+    0x0c, 0x03, 0x80, 0x1f, 0xc0, 0x33, 0xc0, 0x71, 0x80, 0x79, 0x00, 0x3f, 0x00, 0x18, 0x9d, 0x00,
+    0x00, 0x14, 0x00, 0x96, 0x00, 0x0e, 0x18, 0x00, 0x3c, 0x00, 0x78, 0x00, 0x71, 0x80, 0x23, 0x80,
+    0x07, 0x00, 0x0f, 0x00, 0x06, 0x99, 0x00, 0x00, 0x12, 0x00, 0x9a, 0x00, 0x0c, 0x06, 0x00, 0x0c,
+    0x00, 0x18, 0x40, 0x10, 0xc0, 0x00, 0x80, 0x01, 0x00, 0x03, 0x97, 0x00, 0x00, 0x14, 0x00, 0x9c,
+    0x00, 0x0e, 0x03, 0x80, 0x07, 0xc0, 0x09, 0xc0, 0x00, 0x00, 0x18, 0x80, 0x1c, 0x00, 0x0f, 0x00,
+    0x06, 0x93, 0x00, 0x00, 0x14, 0x00, 0xa0, 0x00, 0x0e, 0x06, 0x00, 0x0f, 0x80, 0x07, 0x80, 0x23,
+    0x00, 0x71, 0x00, 0x78, 0x00, 0x3c, 0x00, 0x18, 0x8f, 0x00, 0x00, 0x12, 0x00, 0xa4, 0x00, 0x0c,
+    0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0x41, 0x00, 0x03, 0x00, 0x06, 0x00, 0x0c, 0x8d, 0x00, 0x00,
+    0x14, 0x00, 0xa6, 0x00, 0x0e, 0x0c, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x03, 0x00, 0x60, 0x00, 0x72,
+    0x00, 0x3c, 0x00, 0x18, 0x89, 0x00, 0x00, 0x12, 0x00, 0xaa, 0x00, 0x04, 0x18, 0x00, 0x24, 0x00,
+    0x42, 0x82, 0x00, 0x04, 0x42, 0x00, 0x24, 0x00, 0x18, 0x87, 0x00, 0x00, 0x14, 0x00, 0xac, 0x00,
+    0x0e, 0x18, 0x00, 0x3c, 0x00, 0x66, 0x00, 0x42, 0x00, 0x42, 0x00, 0x66, 0x00, 0x3c, 0x00, 0x18,
+    0x83, 0x00, 0x00, 0x12, 0x00, 0xb0, 0x00, 0x0e, 0x18, 0x00, 0x3c, 0x00, 0x66, 0x00, 0x42, 0x00,
+    0x42, 0x00, 0x66, 0x00, 0x3c, 0x00, 0x18,
+};
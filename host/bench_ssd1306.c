@@ -0,0 +1,522 @@
+// Benchmark da biblioteca ssd1306 no PC: mede o custo de cada primitiva e
+// quantos bytes/transações cada tipo de envio coloca no barramento.
+//
+//   cmake -S . -B build-host -DSSD1306_HOST_BUILD=ON
+//   cmake --build build-host && ./build-host/host/ssd1306_bench
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "bibliotecas/ssd1306.h"
+#include "bibliotecas/animation.h"
+#include "bench_animation.h"
+#include "bibliotecas/ssd1306_spi.h"
+#include "bibliotecas/ssd1306_gray.h"
+#include "bibliotecas/joystick_cal.h"
+#include "bibliotecas/hud.h"
+#include "bibliotecas/font.h"
+#include "bibliotecas/fb_capture.h"
+#include "mock_bus.h"
+#include "mock_display.h"
+
+#define I2C_BAUDRATE (400 * 1000)
+#define SPI_BAUDRATE (10 * 1000 * 1000)
+
+static ssd1306_t ssd;
+static volatile uint8_t sink; // Impede que o compilador descarte o trabalho medido
+static uint32_t spi_baudrate; // Diferente de 0: o tempo no barramento é o do SPI (8 bits por byte)
+
+typedef void (*bench_fn_t)(uint32_t i);
+
+static void bench(const char *name, bench_fn_t fn, uint32_t iterations)
+{
+  mock_bus_reset();
+  absolute_time_t start = get_absolute_time();
+  for (uint32_t i = 0; i < iterations; ++i)
+    fn(i);
+  int64_t elapsed = absolute_time_diff_us(start, get_absolute_time());
+  sink = ssd.ram_buffer[1 + (iterations % (ssd.bufsize - 1))];
+
+  double per_op_ns = elapsed * 1000.0 / iterations;
+  printf("%-28s %10.1f ns/op", name, per_op_ns);
+  if (mock_bus.transactions)
+  {
+    double bus_us = spi_baudrate ? mock_bus.bytes * 8.0 * 1e6 / spi_baudrate : mock_bus_time_us(&mock_bus, I2C_BAUDRATE);
+    printf("  %7.1f bytes/op %5.1f transacoes/op  %7.0f us no barramento",
+           (double)mock_bus.bytes / iterations,
+           (double)mock_bus.transactions / iterations,
+           bus_us / iterations);
+  }
+  printf("\n");
+}
+
+static void bench_pixel(uint32_t i) { ssd1306_pixel(&ssd, i % WIDTH, (i / WIDTH) % HEIGHT, i & 1); }
+static void bench_fill(uint32_t i) { ssd1306_fill(&ssd, i & 1); }
+static void bench_rect(uint32_t i) { ssd1306_rect(&ssd, i % 8, i % 16, 64, 32, i & 1, false); }
+static void bench_rect_filled(uint32_t i) { ssd1306_rect(&ssd, i % 8, i % 16, 64, 32, i & 1, true); }
+static void bench_hline(uint32_t i) { ssd1306_hline(&ssd, 0, WIDTH - 1, i % HEIGHT, i & 1); }
+static void bench_vline(uint32_t i) { ssd1306_vline(&ssd, i % WIDTH, 0, HEIGHT - 1, i & 1); }
+static void bench_line(uint32_t i) { ssd1306_line(&ssd, 0, i % HEIGHT, WIDTH - 1, HEIGHT - 1 - i % HEIGHT, i & 1); }
+static void bench_char(uint32_t i) { ssd1306_draw_char(&ssd, 'A' + i % 26, (i * 8) % (WIDTH - 8), (i % 7) * 8 + (i & 3)); }
+static void bench_string(uint32_t i) { ssd1306_draw_string(&ssd, (i & 1) ? "ADC X 2048" : "ADC Y 4095", 0, 16); }
+static void bench_square(uint32_t i) { draw_square(&ssd, i % (WIDTH - SQUARE_SIZE), i % (HEIGHT - SQUARE_SIZE)); }
+
+static ssd1306_sprite_t sprite;
+static uint8_t sprite_background[SSD1306_SPRITE_BACKGROUND_SIZE(SQUARE_SIZE, SQUARE_SIZE)];
+static void bench_sprite_move(uint32_t i) { ssd1306_sprite_move(&ssd, &sprite, i % (WIDTH - SQUARE_SIZE), i % (HEIGHT - SQUARE_SIZE)); }
+
+static uint8_t border_style;
+static void bench_border(uint32_t i)
+{
+  (void)i;
+  ssd1306_fill(&ssd, false);
+  draw_border(&ssd, border_style);
+}
+
+static void bench_border_copy(uint32_t i)
+{
+  (void)i;
+  draw_border_copy(&ssd, border_style);
+}
+
+static void bench_border_raster(uint32_t i)
+{
+  (void)i;
+  ssd1306_fill(&ssd, false);
+  draw_border_raster(&ssd, border_style);
+}
+
+static void bench_config(uint32_t i)
+{
+  (void)i;
+  ssd1306_config(&ssd);
+}
+
+static void bench_send_data(uint32_t i)
+{
+  (void)i;
+  ssd1306_send_data(&ssd);
+}
+
+// Quadro típico do laço principal: apaga o quadrado, redesenha a borda e
+// desenha o quadrado na nova posição
+static void bench_frame_dirty(uint32_t i)
+{
+  ssd1306_rect(&ssd, 20 + (i - 1) % 16, 40 + (i - 1) % 32, SQUARE_SIZE, SQUARE_SIZE, false, true);
+  draw_border(&ssd, 1);
+  draw_square(&ssd, 40 + i % 32, 20 + i % 16);
+  ssd1306_send_dirty(&ssd);
+}
+
+static void bench_frame_dirty_async(uint32_t i)
+{
+  ssd1306_rect(&ssd, 20 + (i - 1) % 16, 40 + (i - 1) % 32, SQUARE_SIZE, SQUARE_SIZE, false, true);
+  draw_border(&ssd, 1);
+  draw_square(&ssd, 40 + i % 32, 20 + i % 16);
+  ssd1306_send_dirty_async(&ssd);
+}
+
+// Mesmo quadro com o quadrado como sprite: a borda sob ele volta do fundo salvo
+static void bench_frame_sprite(uint32_t i)
+{
+  ssd1306_sprite_move(&ssd, &sprite, 40 + i % 32, 20 + i % 16);
+  ssd1306_send_dirty_async(&ssd);
+}
+
+// Animação comprimida: decodifica o próximo quadro direto no ram_buffer
+static animation_t animation;
+static void bench_animation_frame(uint32_t i)
+{
+  (void)i;
+  animation_next_frame(&animation, &ssd, 60, 3);
+}
+
+static void bench_animation_dirty(uint32_t i)
+{
+  (void)i;
+  animation_next_frame(&animation, &ssd, 60, 3);
+  ssd1306_send_dirty_async(&ssd);
+}
+
+// Dois displays em controladores diferentes (i2c0 e i2c1) com quadro inteiro
+// alterado: ssd1306_send_dirty_all transmite os dois ao mesmo tempo
+static ssd1306_t second;
+static ssd1306_t *const displays[] = {&ssd, &second};
+static void bench_two_displays(uint32_t i)
+{
+  ssd1306_fill(&ssd, i & 1);
+  ssd1306_fill(&second, !(i & 1));
+  ssd1306_send_dirty_all(displays, 2);
+}
+
+// Mesmos envios pelo transporte SPI (D/C e CS em GPIO, sem bytes de controle)
+static ssd1306_t spi_display;
+static ssd1306_spi_t spi_context;
+static void bench_spi_send_data(uint32_t i)
+{
+  ssd1306_fill(&spi_display, i & 1);
+  ssd1306_send_data(&spi_display);
+}
+
+static void bench_spi_frame_async(uint32_t i)
+{
+  ssd1306_rect(&spi_display, 20 + (i - 1) % 16, 40 + (i - 1) % 32, SQUARE_SIZE, SQUARE_SIZE, false, true);
+  draw_border(&spi_display, 1);
+  draw_square(&spi_display, 40 + i % 32, 20 + i % 16);
+  ssd1306_send_dirty_async(&spi_display);
+}
+
+// Desenha quadros variados num display com o transporte simulado e confere,
+// depois de cada envio parcial, que a GDDRAM simulada é igual ao ram_buffer
+static bool check_mock_display(uint32_t frames)
+{
+  static ssd1306_t simulated;
+  static mock_display_t display;
+  static ssd1306_sprite_t marker;
+  static uint8_t marker_background[SSD1306_SPRITE_BACKGROUND_SIZE(SQUARE_SIZE, SQUARE_SIZE)];
+
+  ssd1306_init(&simulated, WIDTH, HEIGHT, false, 0x3C, NULL);
+  mock_display_attach(&simulated, &display);
+  ssd1306_config(&simulated);
+  ssd1306_sprite_init(&marker, SQUARE_SIZE, SQUARE_SIZE, NULL, SSD1306_SPRITE_BACKGROUND, marker_background);
+
+  for (uint32_t i = 0; i < frames; ++i)
+  {
+    switch (i % 5)
+    {
+    case 0:
+      draw_border_copy(&simulated, i % 6);
+      break;
+    case 1:
+      ssd1306_draw_string(&simulated, (i & 2) ? "ADC X 2048" : "ADC Y 95", i % 40, (i * 3) % (HEIGHT - 8));
+      break;
+    case 2:
+      ssd1306_line(&simulated, i % WIDTH, 0, (i * 7) % WIDTH, HEIGHT - 1, i & 8);
+      break;
+    case 3:
+      ssd1306_rect(&simulated, i % 40, (i * 5) % 100, 1 + i % 27, 1 + i % 20, i & 4, i & 1);
+      break;
+    default:
+      ssd1306_sprite_move(&simulated, &marker, (i * 11) % (WIDTH - SQUARE_SIZE), (i * 13) % (HEIGHT - SQUARE_SIZE));
+      break;
+    }
+    if (i % 7 == 6)
+      ssd1306_send_data_async(&simulated);
+    else
+      ssd1306_send_dirty_async(&simulated);
+
+    if (!mock_display_matches(&display, &simulated))
+    {
+      printf("GDDRAM simulada difere do ram_buffer no quadro %u\n", i);
+      return false;
+    }
+  }
+  printf("GDDRAM simulada confere em %u quadros (%zu bytes de dados, %zu de comandos)\n", frames,
+         display.data_bytes, display.commands);
+  return true;
+}
+
+// Mapeamento do joystick por quadro: fórmula antiga (centro fixo em 2048,
+// multiplicação e divisão) contra as tabelas da calibração
+static joystick_cal_t joystick;
+static void bench_joystick_formula(uint32_t i)
+{
+  uint16_t adc = (i * 7) & 0xFFF;
+  int x = (WIDTH / 2 - SQUARE_SIZE / 2) + ((int32_t)(adc - 2048) * (WIDTH - SQUARE_SIZE)) / 4096;
+  int y = (HEIGHT / 2 - SQUARE_SIZE / 2) - ((int32_t)(adc - 2048) * (HEIGHT - SQUARE_SIZE)) / 4096;
+  sink = x + y + abs(adc - 2048);
+}
+
+static void bench_joystick_table(uint32_t i)
+{
+  uint16_t adc = (i * 7) & 0xFFF;
+  sink = joystick_cal_screen(&joystick, 0, adc) + joystick_cal_screen(&joystick, 1, adc) +
+         joystick_cal_brightness(&joystick, 0, adc);
+}
+
+static void bench_joystick_build(uint32_t i)
+{
+  (void)i;
+  joystick_cal_build(&joystick);
+}
+
+// Contador de quatro dígitos (um por quadro) e o envio: o texto inteiro por
+// ssd1306_draw_string com a região alterada, contra o campo do HUD, que só
+// copia e envia (hud_field_flush) os glifos dos dígitos que mudaram
+static hud_field_t hud;
+static void bench_counter_string(uint32_t i)
+{
+  char text[8];
+  snprintf(text, sizeof(text), "X%4u", (unsigned)(i % 4096));
+  ssd1306_draw_string(&ssd, text, 8, 8);
+}
+
+static void bench_counter_hud(uint32_t i)
+{
+  hud_field_printf(&ssd, &hud, "X%4u", (unsigned)(i % 4096));
+}
+
+static void bench_counter_string_dirty(uint32_t i)
+{
+  bench_counter_string(i);
+  ssd1306_send_dirty(&ssd);
+}
+
+static void bench_counter_hud_flush(uint32_t i)
+{
+  bench_counter_hud(i);
+  hud_field_flush(&ssd, &hud);
+}
+
+// Texto proporcional: quantos caracteres de uma frase cabem numa linha,
+// contra as WIDTH / 8 células fixas de ssd1306_draw_char
+static const char bench_text[] = "Posição do joystick: X 2048, Y 4095 (calibração ok)";
+static void bench_text_string(uint32_t i) { ssd1306_draw_string(&ssd, bench_text, 0, (i & 1) * 8); }
+static void bench_text_width(uint32_t i)
+{
+  (void)i;
+  sink = ssd1306_string_width(bench_text);
+}
+
+static unsigned chars_per_line(const char *text)
+{
+  char line[sizeof(bench_text)];
+  unsigned chars = 0, fit = 0;
+  for (size_t n = 0; text[n]; ++n)
+  {
+    // Só mede cortes em fronteira de caractere UTF-8
+    if ((text[n + 1] & 0xC0) == 0x80)
+      continue;
+    ++chars;
+    memcpy(line, text, n + 1);
+    line[n + 1] = '\0';
+    if (ssd1306_string_width(line) > WIDTH)
+      break;
+    fit = chars;
+  }
+  return fit;
+}
+
+// Tons de cinza: uma fatia completa (todos os trechos em que os planos
+// diferem). O tempo no barramento por fatia dá a taxa de planos alcançável.
+static ssd1306_gray_t gray;
+static uint8_t gray_planes[2][WIDTH * HEIGHT / 8 + 1];
+static void bench_gray_slice(uint32_t i)
+{
+  (void)i;
+  while (ssd1306_gray_poll(&gray))
+    ;
+  ssd1306_gray_next_slice(&gray);
+}
+
+// Degradê de quatro faixas na tela inteira: todo byte de nível 1 ou 2 muda a cada fatia
+static void gray_gradient(void)
+{
+  ssd1306_gray_fill(&gray, 0);
+  for (uint8_t level = 0; level < SSD1306_GRAY_LEVELS; ++level)
+    ssd1306_gray_rect(&gray, 0, level * WIDTH / 4, WIDTH / 4, HEIGHT, level, true);
+}
+
+static void bench_gray(const char *name, uint8_t style)
+{
+  if (style < 6)
+    ssd1306_gray_border(&gray, style);
+  else
+    gray_gradient();
+  ssd1306_gray_present(&gray);
+  bench_gray_slice(0); // Envia a região alterada e o resto da fatia em andamento
+
+  bench(name, bench_gray_slice, 3000);
+  double i2c_us = mock_bus_time_us(&mock_bus, I2C_BAUDRATE) / 3000;
+  double fast_us = mock_bus_time_us(&mock_bus, 1000 * 1000) / 3000;
+  printf("  %u trechos: %.0f planos/s (%.0f ciclos de cinza/s), %.0f planos/s a 1 MHz\n", gray.span_count,
+         1e6 / i2c_us, 1e6 / i2c_us / SSD1306_GRAY_SLICES, 1e6 / fast_us);
+}
+
+// Captura do framebuffer: quadro do laço principal (sprite movido) codificado
+// como delta, e um quadro-chave. A saída aceita tudo na hora, para medir só a
+// codificação.
+static fb_capture_t capture;
+static size_t capture_bytes;
+static size_t capture_sink(void *context, const uint8_t *data, size_t len)
+{
+  (void)context;
+  (void)data;
+  capture_bytes += len;
+  return len;
+}
+
+static void bench_capture_delta(uint32_t i)
+{
+  ssd1306_sprite_move(&ssd, &sprite, 40 + i % 32, 20 + i % 16);
+  fb_capture_frame(&capture, &ssd, i);
+  fb_capture_drain(&capture, capture_sink, NULL);
+}
+
+static void bench_capture_keyframe(uint32_t i)
+{
+  fb_capture_start(&capture);
+  fb_capture_frame(&capture, &ssd, i);
+  fb_capture_drain(&capture, capture_sink, NULL);
+}
+
+// Rolagem por hardware: cada passo custa alguns bytes de comando em vez de
+// um quadro inteiro
+static void bench_start_line(uint32_t i) { ssd1306_set_start_line(&ssd, i); }
+static void bench_scroll_horizontal(uint32_t i) { ssd1306_scroll_horizontal(&ssd, i & 1, 0, 7, SSD1306_SCROLL_2_FRAMES); }
+
+// Executa fn uma vez e mostra os bytes exatos que ela colocou no barramento
+static void record(const char *name, bench_fn_t fn)
+{
+  mock_bus_reset();
+  fn(0);
+  printf("%-28s", name);
+  for (size_t i = 0; i < mock_bus.recorded_length; ++i)
+    printf(" %02X", mock_bus.recorded[i]);
+  printf("\n");
+}
+
+static void record_scroll_diagonal(uint32_t i)
+{
+  (void)i;
+  ssd1306_set_vertical_scroll_area(&ssd, 0, HEIGHT);
+  ssd1306_scroll_diagonal(&ssd, false, 0, 7, SSD1306_SCROLL_5_FRAMES, 1);
+}
+
+static void record_scroll_stop(uint32_t i)
+{
+  (void)i;
+  ssd1306_scroll_stop(&ssd);
+}
+
+int main(void)
+{
+  i2c_init(i2c1, I2C_BAUDRATE);
+  ssd1306_init(&ssd, WIDTH, HEIGHT, false, 0x3C, i2c1);
+  animation_init(&animation, bench_animation);
+
+  printf("Primitivas\n");
+  bench("ssd1306_pixel", bench_pixel, 1000000);
+  bench("ssd1306_fill", bench_fill, 100000);
+  bench("ssd1306_rect", bench_rect, 100000);
+  bench("ssd1306_rect (preenchido)", bench_rect_filled, 100000);
+  bench("ssd1306_hline", bench_hline, 100000);
+  bench("ssd1306_vline", bench_vline, 100000);
+  bench("ssd1306_line (diagonal)", bench_line, 100000);
+  bench("ssd1306_draw_char", bench_char, 100000);
+  bench("ssd1306_draw_string", bench_string, 100000);
+  bench("draw_square", bench_square, 100000);
+  ssd1306_sprite_init(&sprite, SQUARE_SIZE, SQUARE_SIZE, NULL, SSD1306_SPRITE_BACKGROUND, sprite_background);
+  bench("ssd1306_sprite_move", bench_sprite_move, 100000);
+
+  printf("\nBordas (fill + draw_border)\n");
+  for (border_style = 0; border_style < 6; ++border_style)
+  {
+    char name[32];
+    snprintf(name, sizeof(name), "draw_border estilo %u", border_style);
+    bench(name, bench_border, 100000);
+  }
+
+  printf("\nBordas pré-calculadas\n");
+  for (border_style = 0; border_style < 6; ++border_style)
+  {
+    char name[32];
+    snprintf(name, sizeof(name), "draw_border_copy estilo %u", border_style);
+    bench(name, bench_border_copy, 100000);
+  }
+  for (border_style = 0; border_style < 6; ++border_style)
+  {
+    char name[32];
+    snprintf(name, sizeof(name), "draw_border_raster estilo %u", border_style);
+    bench(name, bench_border_raster, 100000);
+  }
+
+  printf("\nEnvio (barramento simulado a %u kHz)\n", I2C_BAUDRATE / 1000);
+  bench("ssd1306_config", bench_config, 10000);
+  bench("ssd1306_send_data", bench_send_data, 10000);
+  ssd1306_fill(&ssd, false);
+  draw_border(&ssd, 1);
+  ssd1306_send_data(&ssd);
+  bench("quadro + send_dirty", bench_frame_dirty, 10000);
+  ssd1306_async_init(&ssd, NULL);
+  bench("quadro + send_dirty_async", bench_frame_dirty_async, 10000);
+  ssd1306_sprite_invalidate(&sprite);
+  bench("sprite + send_dirty_async", bench_frame_sprite, 10000);
+
+  i2c_init(i2c0, I2C_BAUDRATE);
+  ssd1306_init(&second, WIDTH, 32, false, 0x3C, i2c0);
+  ssd1306_async_init(&second, NULL);
+  bench("2 displays (64 + 32 linhas)", bench_two_displays, 10000);
+  printf("%-28s %7.0f us i2c0 + %7.0f us i2c1 em paralelo\n", "",
+         mock_bus_time_us(&mock_bus_ports[0], I2C_BAUDRATE) / 10000,
+         mock_bus_time_us(&mock_bus_ports[1], I2C_BAUDRATE) / 10000);
+
+  printf("\nAnimação (%u quadros de %ux%u, %u bytes na flash)\n", animation.frame_count,
+         animation.width, animation.pages * 8, (unsigned)sizeof(bench_animation));
+  bench("animation_next_frame", bench_animation_frame, 100000);
+  bench("animacao + send_dirty_async", bench_animation_dirty, 10000);
+
+  printf("\nHUD (contador de 4 digitos)\n");
+  ssd1306_fill(&ssd, false);
+  hud_field_init(&hud, 8, 8, 5);
+  bench("ssd1306_draw_string", bench_counter_string, 100000);
+  bench("hud_field_printf", bench_counter_hud, 100000);
+  ssd1306_send_data(&ssd);
+  bench("draw_string + send_dirty", bench_counter_string_dirty, 10000);
+  hud_field_invalidate(&hud);
+  bench("hud + hud_field_flush", bench_counter_hud_flush, 10000);
+
+  printf("\nTexto proporcional (fonte Latin-1 na flash)\n");
+  unsigned glyphs = 0;
+  for (unsigned code = 0; code < FONT_CODES; ++code)
+    glyphs = font_index[code] >= glyphs ? font_index[code] + 1u : glyphs;
+  printf("  %u glyphs, %u bytes const (indice + glyphs), 0 bytes de RAM\n", glyphs,
+         (unsigned)(sizeof(font_index) + glyphs * sizeof(font_glyph_t)));
+  printf("  %u caracteres por linha (%u em celulas de 8 pixels)\n", chars_per_line(bench_text), WIDTH / 8);
+  bench("ssd1306_draw_string (UTF-8)", bench_text_string, 100000);
+  bench("ssd1306_string_width", bench_text_width, 100000);
+
+  printf("\nRolagem por hardware\n");
+  bench("ssd1306_set_start_line", bench_start_line, 10000);
+  bench("ssd1306_scroll_horizontal", bench_scroll_horizontal, 10000);
+  record("horizontal (bytes)", bench_scroll_horizontal);
+  record("diagonal (bytes)", record_scroll_diagonal);
+  record("stop (bytes)", record_scroll_stop);
+  record("start line (bytes)", bench_start_line);
+
+  printf("\nSPI (D/C e CS em GPIO, %u MHz)\n", SPI_BAUDRATE / 1000000);
+  spi_baudrate = spi_init(spi0, SPI_BAUDRATE);
+  ssd1306_init(&spi_display, WIDTH, HEIGHT, false, 0, NULL);
+  ssd1306_spi_attach(&spi_display, &spi_context, spi0, 16, 17);
+  ssd1306_async_init(&spi_display, NULL);
+  bench("ssd1306_send_data (SPI)", bench_spi_send_data, 10000);
+  bench("quadro + send_dirty_async", bench_spi_frame_async, 10000);
+  spi_baudrate = 0;
+
+  printf("\nTons de cinza (%u niveis, %u fatias por ciclo, I2C a %u kHz)\n", SSD1306_GRAY_LEVELS,
+         SSD1306_GRAY_SLICES, I2C_BAUDRATE / 1000);
+  ssd1306_gray_init(&gray, &ssd, gray_planes[0], gray_planes[1]);
+  bench_gray("borda 3D (estilo 3)", 3);
+  bench_gray("profundidade (estilo 5)", 5);
+  bench_gray("degrade (tela inteira)", 6);
+
+  printf("\nCaptura do framebuffer (XOR + RLE)\n");
+  draw_border_copy(&ssd, 1);
+  ssd1306_sprite_invalidate(&sprite);
+  fb_capture_init(&capture);
+  fb_capture_start(&capture);
+  capture_bytes = 0;
+  bench("sprite + fb_capture_frame", bench_capture_delta, 100000);
+  printf("  %.1f bytes/quadro (quadro-chave a cada %u)\n", capture_bytes / 100000.0, FB_CAPTURE_KEYFRAME_INTERVAL);
+  capture_bytes = 0;
+  bench("fb_capture_frame (chave)", bench_capture_keyframe, 100000);
+  printf("  %.1f bytes/quadro\n", capture_bytes / 100000.0);
+
+  printf("\nJoystick\n");
+  joystick_cal_init(&joystick, WIDTH - SQUARE_SIZE, HEIGHT - SQUARE_SIZE);
+  bench("formula (centro fixo)", bench_joystick_formula, 1000000);
+  bench("joystick_cal (tabelas)", bench_joystick_table, 1000000);
+  bench("joystick_cal_build", bench_joystick_build, 1000);
+
+  printf("\nTransporte simulado\n");
+  return check_mock_display(5000) ? 0 : 1;
+}
@@ -0,0 +1,81 @@
+// Benchmark do template Ssd1306<W, H> contra a API em C: o mesmo desenho
+// feito com ssd1306_pixel, com pixel() (dimensões constantes) e com set<X, Y>()
+// (coordenadas constantes), conferindo que os três buffers ficam idênticos.
+//
+//   cmake --build build-host && ./build-host/host/ssd1306_bench_cpp
+#include <stdio.h>
+#include <string.h>
+#include <type_traits>
+#include "pico/stdlib.h"
+#include "bibliotecas/ssd1306.hpp"
+
+static ssd1306_t ssd;
+
+// O objeto guarda o próprio framebuffer: cópias não podem existir
+static_assert(!std::is_copy_constructible<Ssd1306<WIDTH, HEIGHT>>::value, "Ssd1306 não deve ser copiável");
+static_assert(!std::is_copy_assignable<Ssd1306<WIDTH, HEIGHT>>::value, "Ssd1306 não deve ser atribuível");
+static Ssd1306<WIDTH, HEIGHT> display;
+static volatile uint8_t sink; // Impede que o compilador descarte o trabalho medido
+
+template <typename F>
+static void bench(const char *name, F fn, uint32_t iterations)
+{
+  absolute_time_t start = get_absolute_time();
+  for (uint32_t i = 0; i < iterations; ++i)
+    fn(i);
+  int64_t elapsed = absolute_time_diff_us(start, get_absolute_time());
+  sink = display.buffer()[1 + (iterations % (display.buffer_size - 1))] ^ ssd.ram_buffer[1];
+  printf("%-28s %10.1f ns/op\n", name, elapsed * 1000.0 / iterations);
+}
+
+// Marcador 3x3 em posição fixa, o tipo de desenho que set<X, Y> atende
+static void marker_c(bool value)
+{
+  for (uint8_t y = 30; y < 33; ++y)
+    for (uint8_t x = 62; x < 65; ++x)
+      ssd1306_pixel(&ssd, x, y, value);
+}
+
+static void marker_template(bool value)
+{
+  display.set<62, 30>(value);
+  display.set<63, 30>(value);
+  display.set<64, 30>(value);
+  display.set<62, 31>(value);
+  display.set<63, 31>(value);
+  display.set<64, 31>(value);
+  display.set<62, 32>(value);
+  display.set<63, 32>(value);
+  display.set<64, 32>(value);
+}
+
+int main(void)
+{
+  static uint8_t c_buffer[SSD1306_BUFFER_SIZE(WIDTH, HEIGHT)];
+  ssd1306_init_with_buffer(&ssd, WIDTH, HEIGHT, false, 0x3C, i2c1, c_buffer);
+  display.init(false, 0x3C, i2c1);
+
+  printf("Pixel (%ux%u)\n", WIDTH, HEIGHT);
+  bench("ssd1306_pixel", [](uint32_t i) { ssd1306_pixel(&ssd, i % WIDTH, (i / WIDTH) % HEIGHT, i & 1); }, 1000000);
+  bench("Ssd1306::pixel", [](uint32_t i) { display.pixel(i % WIDTH, (i / WIDTH) % HEIGHT, i & 1); }, 1000000);
+  bench("marcador 3x3 ssd1306_pixel", [](uint32_t i) { marker_c(i & 1); }, 1000000);
+  bench("marcador 3x3 Ssd1306::set", [](uint32_t i) { marker_template(i & 1); }, 1000000);
+
+  // Mesmo desenho pelos dois caminhos, incluindo a região alterada
+  ssd1306_fill(&ssd, false);
+  display.fill(false);
+  ssd1306_clear_dirty(&ssd);
+  ssd1306_clear_dirty(display.handle());
+  for (uint16_t i = 0; i < WIDTH * 4; ++i)
+  {
+    ssd1306_pixel(&ssd, (i * 7) % WIDTH, (i * 3) % HEIGHT, true);
+    display.pixel((i * 7) % WIDTH, (i * 3) % HEIGHT, true);
+  }
+  marker_c(true);
+  marker_template(true);
+  ssd1306_t *t = display.handle();
+  bool same = memcmp(c_buffer, display.buffer(), display.buffer_size) == 0 && ssd.dirty_x0 == t->dirty_x0 &&
+              ssd.dirty_x1 == t->dirty_x1 && ssd.dirty_page0 == t->dirty_page0 && ssd.dirty_page1 == t->dirty_page1;
+  printf("\nbuffers %s\n", same ? "idênticos" : "DIFERENTES");
+  return same ? 0 : 1;
+}
@@ -0,0 +1,221 @@
+"""Decodifica a captura do framebuffer enviada pela USB (ver bibliotecas/fb_capture.h).
+
+Uso:
+    python3 host/decode_fbcapture.py captura.bin quadros/              # arquivo gravado
+    python3 host/decode_fbcapture.py /dev/ttyACM0 quadros/ --serial    # porta serial (pyserial)
+
+Opções:
+    --png          grava PNG em vez de PBM
+    --golden DIR   compara cada quadro com o PBM de mesmo nome em DIR e
+                   termina com erro se algum pixel for diferente
+
+Grava um arquivo por quadro (quadro_000000.pbm, ...) com os pixels acesos em
+branco, como no painel, e timing.csv com o instante de cada quadro. Texto do
+stdio misturado na mesma porta é ignorado (ressincroniza em 'FB' + Fletcher-16).
+"""
+import os
+import struct
+import sys
+import zlib
+
+MAGIC = b"FB"
+HEADER_SIZE = 15
+FLAG_KEYFRAME = 0x01
+MAX_PAYLOAD = 1024 + 1024 // 128
+
+
+def fletcher16(data):
+    sum1 = sum2 = 0
+    for byte in data:
+        sum1 = (sum1 + byte) % 255
+        sum2 = (sum2 + sum1) % 255
+    return sum1, sum2
+
+
+def decode_packets(chunks):
+    """Gera (cabeçalho, carga) dos quadros válidos, ressincronizando no 'FB'."""
+    buffer = bytearray()
+    for chunk in chunks:
+        buffer.extend(chunk)
+        while len(buffer) >= HEADER_SIZE:
+            start = buffer.find(MAGIC)
+            if start < 0:
+                del buffer[:-1]
+                break
+            del buffer[:start]
+            if len(buffer) < HEADER_SIZE:
+                break
+            (_, sequence, timestamp, width, pages, flags, dropped,
+             size) = struct.unpack("<2sHIBBBHH", bytes(buffer[:HEADER_SIZE]))
+            if size > MAX_PAYLOAD or width == 0 or pages == 0:
+                del buffer[0]
+                continue
+            total = HEADER_SIZE + size + 2
+            if len(buffer) < total:
+                break
+            if tuple(buffer[total - 2:total]) != fletcher16(buffer[:total - 2]):
+                del buffer[0]
+                continue
+            header = {
+                "sequence": sequence,
+                "timestamp_us": timestamp,
+                "width": width,
+                "pages": pages,
+                "keyframe": int(bool(flags & FLAG_KEYFRAME)),
+                "dropped": dropped,
+                "bytes": total,
+            }
+            payload = bytes(buffer[HEADER_SIZE:HEADER_SIZE + size])
+            del buffer[:total]
+            yield header, payload
+
+
+def apply_delta(frame, payload):
+    """Aplica a carga (sequências de XOR) sobre o quadro anterior."""
+    i = 0
+    pos = 0
+    while pos < len(payload):
+        token = payload[pos]
+        pos += 1
+        if token >= 0x80:
+            i += token - 0x7F
+        else:
+            for byte in payload[pos:pos + token + 1]:
+                frame[i] ^= byte
+                i += 1
+            pos += token + 1
+    if i != len(frame):
+        raise ValueError(f"carga cobre {i} bytes, quadro tem {len(frame)}")
+
+
+def decode_frames(chunks):
+    """Gera (cabeçalho, quadro em ordem de GDDRAM). Depois de um quadro
+    perdido no caminho, descarta os deltas até o próximo quadro-chave."""
+    frame = None
+    expected = None
+    for header, payload in decode_packets(chunks):
+        size = header["width"] * header["pages"]
+        if header["keyframe"]:
+            frame = bytearray(size)
+        elif frame is None or len(frame) != size or header["sequence"] != expected:
+            frame = None
+            expected = None
+            continue
+        expected = (header["sequence"] + 1) & 0xFFFF
+        apply_delta(frame, payload)
+        yield header, bytes(frame)
+
+
+def to_rows(frame, width, pages):
+    """Converte a ordem da GDDRAM (coluna a coluna, 8 linhas por byte) em
+    linhas de pixels (1 = aceso)."""
+    return [[(frame[x * pages + y // 8] >> (y & 7)) & 1 for x in range(width)] for y in range(pages * 8)]
+
+
+def pbm_bytes(rows):
+    # No PBM 1 é preto: o pixel aceso fica branco, como no painel
+    width = len(rows[0])
+    out = bytearray(f"P4\n{width} {len(rows)}\n".encode())
+    for row in rows:
+        for x in range(0, width, 8):
+            byte = 0
+            for bit, pixel in enumerate(row[x:x + 8]):
+                if not pixel:
+                    byte |= 0x80 >> bit
+            out.append(byte)
+    return bytes(out)
+
+
+def read_pbm(path):
+    with open(path, "rb") as file:
+        data = file.read()
+    fields = data.split(maxsplit=3)
+    if fields[0] != b"P4":
+        raise ValueError(f"{path}: só PBM binário (P4)")
+    width, height, raster = int(fields[1]), int(fields[2]), fields[3]
+    stride = (width + 7) // 8
+    return [[0 if raster[y * stride + x // 8] & (0x80 >> (x & 7)) else 1 for x in range(width)]
+            for y in range(height)]
+
+
+def png_bytes(rows):
+    width, height = len(rows[0]), len(rows)
+    raw = b"".join(b"\x00" + bytes(255 if pixel else 0 for pixel in row) for row in rows)
+
+    def chunk(kind, data):
+        return (struct.pack(">I", len(data)) + kind + data +
+                struct.pack(">I", zlib.crc32(kind + data) & 0xFFFFFFFF))
+
+    return (b"\x89PNG\r\n\x1a\n" +
+            chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 0, 0, 0, 0)) +
+            chunk(b"IDAT", zlib.compress(raw)) + chunk(b"IEND", b""))
+
+
+def read_chunks(source, serial_port):
+    if serial_port:
+        import serial  # pyserial, só necessário para ler da porta
+
+        with serial.Serial(source, 115200, timeout=1) as port:
+            while True:
+                yield port.read(4096)
+    else:
+        with open(source, "rb") as file:
+            while True:
+                chunk = file.read(4096)
+                if not chunk:
+                    return
+                yield chunk
+
+
+def main():
+    args = sys.argv[1:]
+    png = "--png" in args
+    serial_port = "--serial" in args
+    golden = None
+    if "--golden" in args:
+        golden = args[args.index("--golden") + 1]
+        del args[args.index("--golden"):args.index("--golden") + 2]
+    args = [arg for arg in args if not arg.startswith("--")]
+    if len(args) != 2:
+        print(__doc__)
+        sys.exit(1)
+
+    source, output = args
+    os.makedirs(output, exist_ok=True)
+    columns = ["index", "sequence", "timestamp_us", "interval_us", "keyframe", "bytes", "dropped"]
+    decoded = mismatched = 0
+    previous_us = None
+    with open(os.path.join(output, "timing.csv"), "w") as timing:
+        timing.write(",".join(columns) + "\n")
+        try:
+            for header, frame in decode_frames(read_chunks(source, serial_port)):
+                rows = to_rows(frame, header["width"], header["pages"])
+                name = f"quadro_{decoded:06d}"
+                with open(os.path.join(output, name + (".png" if png else ".pbm")), "wb") as file:
+                    file.write(png_bytes(rows) if png else pbm_bytes(rows))
+
+                interval = "" if previous_us is None else (header["timestamp_us"] - previous_us) & 0xFFFFFFFF
+                previous_us = header["timestamp_us"]
+                record = dict(header, index=decoded, interval_us=interval)
+                timing.write(",".join(str(record[column]) for column in columns) + "\n")
+
+                if golden is not None:
+                    reference = os.path.join(golden, name + ".pbm")
+                    if os.path.exists(reference):
+                        expected = read_pbm(reference)
+                        diff = sum(a != b for row_a, row_b in zip(rows, expected) for a, b in zip(row_a, row_b))
+                        if diff or len(expected) != len(rows):
+                            mismatched += 1
+                            print(f"{name}: {diff} pixels diferentes de {reference}", file=sys.stderr)
+                decoded += 1
+        except KeyboardInterrupt:
+            pass
+
+    print(f"# {decoded} quadros decodificados em {output}", file=sys.stderr)
+    if golden is not None:
+        print(f"# {mismatched} quadros diferentes das referências", file=sys.stderr)
+        sys.exit(1 if mismatched else 0)
+
+
+if __name__ == "__main__":
+    main()
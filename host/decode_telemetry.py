@@ -0,0 +1,100 @@
+"""Decodifica a telemetria binária da placa (ver bibliotecas/telemetry.h).
+
+Uso:
+    python3 host/decode_telemetry.py captura.bin          # arquivo gravado
+    python3 host/decode_telemetry.py /dev/ttyACM0 115200  # porta serial (pyserial)
+
+Imprime um CSV por registro e, no fim, quantos quadros foram perdidos no
+caminho (saltos de sequência) e quantos a placa descartou: com o anel cheio
+(perda de verdade) ou pelo limite de taxa (registros a mais no mesmo quadro).
+"""
+import struct
+import sys
+
+MAGIC = 0xA5
+FRAME_SIZE = 21
+FLAG_PWM_ENABLED = 0x01
+FLAG_LED_GREEN = 0x02
+
+
+def checksum(data):
+    value = 0
+    for byte in data:
+        value ^= byte
+    return value
+
+
+def decode_frames(chunks):
+    """Gera os registros válidos, ressincronizando no byte 0xA5 + checksum."""
+    buffer = bytearray()
+    for chunk in chunks:
+        buffer.extend(chunk)
+        while len(buffer) >= FRAME_SIZE:
+            if buffer[0] != MAGIC or checksum(buffer[:FRAME_SIZE - 1]) != buffer[FRAME_SIZE - 1]:
+                del buffer[0]
+                continue
+            (_, sequence, timestamp, adc_x, adc_y, pwm_red, pwm_blue,
+             style, flags, dropped_full, dropped_rate, _) = struct.unpack("<BBIHHHHBBHHB", bytes(buffer[:FRAME_SIZE]))
+            del buffer[:FRAME_SIZE]
+            yield {
+                "sequence": sequence,
+                "timestamp_us": timestamp,
+                "adc_x": adc_x,
+                "adc_y": adc_y,
+                "pwm_red": pwm_red,
+                "pwm_blue": pwm_blue,
+                "border_style": style,
+                "pwm_enabled": int(bool(flags & FLAG_PWM_ENABLED)),
+                "led_green": int(bool(flags & FLAG_LED_GREEN)),
+                "dropped_full": dropped_full,
+                "dropped_rate": dropped_rate,
+            }
+
+
+def read_chunks(source, baudrate=None):
+    if baudrate is not None:
+        import serial  # pyserial, só necessário para ler da porta
+
+        with serial.Serial(source, baudrate, timeout=1) as port:
+            while True:
+                yield port.read(256)
+    else:
+        with open(source, "rb") as file:
+            while True:
+                chunk = file.read(4096)
+                if not chunk:
+                    return
+                yield chunk
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(__doc__)
+        sys.exit(1)
+
+    baudrate = int(sys.argv[2]) if len(sys.argv) > 2 else None
+    columns = ["sequence", "timestamp_us", "adc_x", "adc_y", "pwm_red", "pwm_blue",
+               "border_style", "pwm_enabled", "led_green", "dropped_full", "dropped_rate"]
+    print(",".join(columns))
+
+    previous = None
+    lost = 0
+    last_full = 0
+    last_rate = 0
+    try:
+        for record in decode_frames(read_chunks(sys.argv[1], baudrate)):
+            if previous is not None:
+                lost += (record["sequence"] - previous - 1) & 0xFF
+            previous = record["sequence"]
+            last_full = record["dropped_full"]
+            last_rate = record["dropped_rate"]
+            print(",".join(str(record[column]) for column in columns))
+    except KeyboardInterrupt:
+        pass
+
+    print(f"# perdidos no caminho: {lost}, descartados na placa: {last_full} com o anel cheio, "
+          f"{last_rate} pelo limite de taxa", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,67 @@
+// Gera bibliotecas/border_layers.h rasterizando cada estilo com
+// draw_border_raster. Rodar novamente sempre que um estilo mudar:
+//
+//   ./build-host/host/gen_border_layers > bibliotecas/border_layers.h
+#include <stdio.h>
+#include "bibliotecas/ssd1306.h"
+
+#define STYLES 6
+
+int main(void)
+{
+  ssd1306_t ssd;
+  ssd1306_init(&ssd, WIDTH, HEIGHT, false, 0x3C, i2c1);
+
+  printf("// Camadas pré-calculadas dos estilos de draw_border (%dx%d, mesmo layout do ram_buffer).\n", WIDTH, HEIGHT);
+  printf("// Gerado por host/gen_border_layers.c a partir de draw_border_raster; não editar à mão.\n");
+  printf("#pragma once\n\n");
+  printf("#include <stdint.h>\n\n");
+  printf("#define BORDER_LAYER_STYLES %d\n", STYLES);
+  printf("#define BORDER_LAYER_SIZE (WIDTH * HEIGHT / 8)\n\n");
+  printf("static const uint8_t border_layers[BORDER_LAYER_STYLES][BORDER_LAYER_SIZE] = {\n");
+  for (uint8_t style = 0; style < STYLES; ++style)
+  {
+    ssd1306_fill(&ssd, false);
+    draw_border_raster(&ssd, style);
+    printf("    { // Estilo %u\n", style);
+    for (size_t i = 1; i < ssd.bufsize; ++i)
+    {
+      if ((i - 1) % 16 == 0)
+        printf("        ");
+      printf("0x%02x,", ssd.ram_buffer[i]);
+      printf((i % 16 == 0) ? "\n" : " ");
+    }
+    printf("    },\n");
+  }
+  printf("};\n");
+
+  // Índices dos bytes não nulos de cada camada, para que draw_border só
+  // combine os bytes que a borda realmente ocupa
+  printf("\n");
+  for (uint8_t style = 0; style < STYLES; ++style)
+  {
+    ssd1306_fill(&ssd, false);
+    draw_border_raster(&ssd, style);
+    printf("static const uint16_t border_layer_offsets_%u[] = {", style);
+    size_t count = 0;
+    for (size_t i = 1; i < ssd.bufsize; ++i)
+    {
+      if (ssd.ram_buffer[i])
+      {
+        printf((count % 16 == 0) ? "\n    " : " ");
+        printf("%zu,", i - 1);
+        count++;
+      }
+    }
+    printf("\n};\n");
+  }
+  printf("\nstatic const uint16_t *const border_layer_offsets[BORDER_LAYER_STYLES] = {\n");
+  for (uint8_t style = 0; style < STYLES; ++style)
+    printf("    border_layer_offsets_%u,\n", style);
+  printf("};\n\n");
+  printf("static const uint16_t border_layer_offset_count[BORDER_LAYER_STYLES] = {\n");
+  for (uint8_t style = 0; style < STYLES; ++style)
+    printf("    sizeof(border_layer_offsets_%u) / sizeof(uint16_t),\n", style);
+  printf("};\n");
+  return 0;
+}
@@ -0,0 +1,23 @@
+// Substituto do hardware/clocks.h: clk_sys fixo em 125 MHz, como na placa
+#pragma once
+
+#include "pico/stdlib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum clock_index
+{
+  clk_sys = 5,
+};
+
+static inline uint32_t clock_get_hz(enum clock_index clk_index)
+{
+  (void)clk_index;
+  return 125000000u;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,48 @@
+// Substituto do hardware/pwm.h: os níveis ficam guardados por GPIO e a
+// interrupção de wrap só roda quando o teste pede (mock_pwm.h)
+#pragma once
+
+#include "pico/stdlib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NUM_PWM_SLICES 8
+
+typedef struct
+{
+  float clkdiv;
+  uint16_t wrap;
+} pwm_config;
+
+static inline uint pwm_gpio_to_slice_num(uint gpio)
+{
+  return (gpio >> 1) & 7u;
+}
+
+static inline pwm_config pwm_get_default_config(void)
+{
+  pwm_config config = {1.0f, 0xffff};
+  return config;
+}
+
+static inline void pwm_config_set_clkdiv(pwm_config *c, float div)
+{
+  c->clkdiv = div;
+}
+
+static inline void pwm_config_set_wrap(pwm_config *c, uint16_t wrap)
+{
+  c->wrap = wrap;
+}
+
+void pwm_init(uint slice_num, pwm_config *c, bool start);
+void pwm_set_gpio_level(uint gpio, uint16_t level);
+uint32_t pwm_get_irq_status_mask(void);
+void pwm_clear_irq(uint slice_num);
+void pwm_set_irq_enabled(uint slice_num, bool enabled);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,32 @@
+// Substituto do hardware/spi.h: as escritas vão para o barramento simulado (mock_bus.h)
+#pragma once
+
+#include "pico/stdlib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct spi_inst spi_inst_t;
+
+#define NUM_SPIS 2
+
+typedef struct
+{
+  volatile uint32_t dr;
+  volatile uint32_t sr;
+} spi_hw_t;
+
+extern spi_inst_t *spi0;
+extern spi_inst_t *spi1;
+
+uint spi_init(spi_inst_t *spi, uint baudrate);
+int spi_write_blocking(spi_inst_t *spi, const uint8_t *src, size_t len);
+bool spi_is_busy(const spi_inst_t *spi);
+spi_hw_t *spi_get_hw(spi_inst_t *spi);
+uint spi_get_index(const spi_inst_t *spi);
+uint spi_get_dreq(spi_inst_t *spi, bool is_tx);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,23 @@
+// Substituto do hardware/sync.h: no PC as interrupções simuladas só rodam
+// quando chamadas, então não há o que desligar
+#pragma once
+
+#include "pico/stdlib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static inline uint32_t save_and_disable_interrupts(void)
+{
+  return 0;
+}
+
+static inline void restore_interrupts(uint32_t status)
+{
+  (void)status;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,33 @@
+// Barramento I2C simulado usado pela compilação para PC
+#pragma once
+
+#include <stddef.h>
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MOCK_BUS_RECORD_SIZE 64
+
+typedef struct
+{
+  size_t transactions; // Transações (START ... STOP)
+  size_t bytes;        // Bytes após o endereço, incluindo bytes de controle
+  uint8_t recorded[MOCK_BUS_RECORD_SIZE]; // Primeiros bytes enviados desde o último reset
+  size_t recorded_length;
+} mock_bus_stats_t;
+
+extern mock_bus_stats_t mock_bus;
+extern mock_bus_stats_t mock_bus_ports[2]; // Mesmas contagens separadas por controlador (i2c0, i2c1)
+
+void mock_bus_reset(void);
+
+// Tempo que os bytes registrados levariam no barramento real (9 bits por byte
+// + endereço de cada transação), em microssegundos
+double mock_bus_time_us(const mock_bus_stats_t *stats, unsigned baudrate);
+
+#ifdef __cplusplus
+}
+#endif
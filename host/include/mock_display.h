@@ -0,0 +1,40 @@
+// Transporte simulado: em vez de bytes no barramento, interpreta os comandos
+// de endereçamento e grava os dados numa GDDRAM simulada, para conferir no PC
+// que o que chega ao display é igual ao ram_buffer
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct ssd1306 ssd1306_t; // bibliotecas/ssd1306.h
+typedef struct ssd1306_transport ssd1306_transport_t;
+
+typedef struct
+{
+  uint8_t ram[128 * 8];             // GDDRAM, coluna a coluna (modo de endereçamento vertical)
+  uint8_t col0, col1, page0, page1; // Janela definida por SET_COL_ADDR/SET_PAGE_ADDR
+  uint8_t col, page;                // Próxima posição escrita
+  uint8_t command, args[6];         // Comando em andamento e seus argumentos
+  uint8_t arg_count, arg_needed;
+  size_t commands;   // Bytes de comando recebidos
+  size_t data_bytes; // Bytes de dados recebidos
+  size_t writes;     // Chamadas de write_commands/write_data
+} mock_display_t;
+
+extern const ssd1306_transport_t mock_display_transport;
+
+// Usa o transporte simulado no display, com a GDDRAM zerada e a janela
+// cobrindo a tela inteira, como depois do reset
+void mock_display_attach(ssd1306_t *ssd, mock_display_t *display);
+
+// Compara a GDDRAM simulada com o ram_buffer do display
+bool mock_display_matches(const mock_display_t *display, const ssd1306_t *ssd);
+
+#ifdef __cplusplus
+}
+#endif
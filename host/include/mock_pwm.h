@@ -0,0 +1,12 @@
+// PWM simulado usado pela compilação para PC (hardware/pwm.h)
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+uint16_t mock_pwm_level(unsigned gpio); // Último nível escrito no GPIO
+bool mock_pwm_irq_enabled(unsigned slice);
+
+// Simula `count` wraps: cada um marca os slices com interrupção ligada e chama
+// o handler de PWM_IRQ_WRAP. Retorna quantos wraps acharam a interrupção ligada.
+unsigned mock_pwm_wrap(unsigned count);
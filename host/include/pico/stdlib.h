@@ -0,0 +1,70 @@
+// Substituto mínimo do pico/stdlib.h para compilar a biblioteca no PC.
+// Só declara o que o código em bibliotecas/ usa; ver host/pico_stubs.c.
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef unsigned int uint;
+typedef uint64_t absolute_time_t;
+
+#define GPIO_OUT 1
+#define GPIO_FUNC_PWM 4
+
+// Relógio simulado para testes que dependem de prazos: com um passo
+// diferente de zero, cada leitura do relógio o avança esse tanto e sleep_us
+// só o adianta, então o resultado não depende da carga da máquina
+extern uint64_t mock_clock_step_us;
+
+absolute_time_t get_absolute_time(void);
+void sleep_ms(uint32_t ms);
+void sleep_us(uint64_t us);
+void gpio_init(uint gpio);
+void gpio_set_dir(uint gpio, bool out);
+void gpio_put(uint gpio, bool value);
+bool gpio_get(uint gpio); // Último valor de gpio_put
+void gpio_set_function(uint gpio, uint fn);
+
+static inline uint64_t to_us_since_boot(absolute_time_t t)
+{
+  return t;
+}
+
+static inline int64_t absolute_time_diff_us(absolute_time_t from, absolute_time_t to)
+{
+  return (int64_t)(to - from);
+}
+
+static inline bool time_reached(absolute_time_t t)
+{
+  return get_absolute_time() >= t;
+}
+
+static inline absolute_time_t delayed_by_us(absolute_time_t t, uint64_t us)
+{
+  return t + us;
+}
+
+static inline absolute_time_t make_timeout_time_us(uint64_t us)
+{
+  return get_absolute_time() + us;
+}
+
+// Sem WFE no PC: só diz se o prazo chegou, e quem chama fica no laço
+static inline bool best_effort_wfe_or_timeout(absolute_time_t t)
+{
+  return time_reached(t);
+}
+
+static inline void tight_loop_contents(void)
+{
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,119 @@
+// Transporte simulado do SSD1306; ver include/mock_display.h
+#include <string.h>
+#include "bibliotecas/ssd1306.h"
+#include "mock_display.h"
+
+static void mock_write_commands(ssd1306_t *ssd, const uint8_t *commands, size_t count);
+static void mock_write_data(ssd1306_t *ssd, uint8_t *data, size_t count);
+
+// Sem start_async: ssd1306_async_init falha e os envios assíncronos viram
+// envios bloqueantes
+const ssd1306_transport_t mock_display_transport = {
+    .write_commands = mock_write_commands,
+    .write_data = mock_write_data,
+};
+
+void mock_display_attach(ssd1306_t *ssd, mock_display_t *display)
+{
+  memset(display, 0, sizeof(*display));
+  display->col1 = 127;
+  display->page1 = 7;
+  ssd1306_set_transport(ssd, &mock_display_transport, display);
+}
+
+bool mock_display_matches(const mock_display_t *display, const ssd1306_t *ssd)
+{
+  for (uint8_t x = 0; x < ssd->width; ++x)
+  {
+    for (uint8_t page = 0; page < ssd->pages; ++page)
+    {
+      if (display->ram[x * 8 + page] != ssd->ram_buffer[ssd1306_index(ssd, x, page)])
+        return false;
+    }
+  }
+  return true;
+}
+
+// Bytes de argumento que seguem cada comando
+static uint8_t argument_count(uint8_t command)
+{
+  switch (command)
+  {
+  case SET_HSCROLL_RIGHT:
+  case SET_HSCROLL_LEFT:
+    return 6;
+  case SET_VHSCROLL_RIGHT:
+  case SET_VHSCROLL_LEFT:
+    return 5;
+  case SET_COL_ADDR:
+  case SET_PAGE_ADDR:
+  case SET_VSCROLL_AREA:
+    return 2;
+  case SET_MEM_ADDR:
+  case SET_MUX_RATIO:
+  case SET_DISP_OFFSET:
+  case SET_COM_PIN_CFG:
+  case SET_DISP_CLK_DIV:
+  case SET_PRECHARGE:
+  case SET_VCOM_DESEL:
+  case SET_CONTRAST:
+  case SET_CHARGE_PUMP:
+    return 1;
+  default:
+    return 0;
+  }
+}
+
+static void mock_execute(mock_display_t *display)
+{
+  if (display->command == SET_COL_ADDR)
+  {
+    display->col0 = display->col = display->args[0] & 0x7F;
+    display->col1 = display->args[1] & 0x7F;
+  }
+  else if (display->command == SET_PAGE_ADDR)
+  {
+    display->page0 = display->page = display->args[0] & 0x07;
+    display->page1 = display->args[1] & 0x07;
+  }
+}
+
+// Um comando e seus argumentos podem vir em chamadas separadas
+static void mock_write_commands(ssd1306_t *ssd, const uint8_t *commands, size_t count)
+{
+  mock_display_t *display = ssd->bus;
+  display->writes++;
+  display->commands += count;
+  for (size_t i = 0; i < count; ++i)
+  {
+    if (display->arg_count < display->arg_needed)
+      display->args[display->arg_count++] = commands[i];
+    else
+    {
+      display->command = commands[i];
+      display->arg_count = 0;
+      display->arg_needed = argument_count(commands[i]);
+    }
+    if (display->arg_count == display->arg_needed)
+      mock_execute(display);
+  }
+}
+
+// Modo vertical: percorre as páginas da janela em cada coluna e volta ao
+// início da janela depois da última
+static void mock_write_data(ssd1306_t *ssd, uint8_t *data, size_t count)
+{
+  mock_display_t *display = ssd->bus;
+  display->writes++;
+  display->data_bytes += count;
+  for (size_t i = 0; i < count; ++i)
+  {
+    display->ram[display->col * 8 + display->page] = data[i];
+    if (display->page++ == display->page1)
+    {
+      display->page = display->page0;
+      if (display->col++ == display->col1)
+        display->col = display->col0;
+    }
+  }
+}
@@ -0,0 +1,412 @@
+// Implementação dos substitutos do pico SDK usados na compilação para PC
+#define _POSIX_C_SOURCE 199309L
+#include <time.h>
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "hardware/spi.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/pwm.h"
+#include "mock_bus.h"
+#include "mock_pwm.h"
+
+mock_bus_stats_t mock_bus;
+mock_bus_stats_t mock_bus_ports[2];
+
+static struct i2c_inst
+{
+  i2c_hw_t hw;
+  bool draining; // Últimos bytes do DMA ainda na FIFO (durante a interrupção do DMA)
+} i2c_instances[2];
+
+i2c_inst_t *i2c0 = &i2c_instances[0];
+i2c_inst_t *i2c1 = &i2c_instances[1];
+
+static struct spi_inst
+{
+  spi_hw_t hw;
+} spi_instances[2];
+
+spi_inst_t *spi0 = &spi_instances[0];
+spi_inst_t *spi1 = &spi_instances[1];
+
+static bool dma_claimed[NUM_DMA_CHANNELS];
+static bool dma_irq0_enabled[NUM_DMA_CHANNELS];
+static bool dma_irq0_status[NUM_DMA_CHANNELS];
+static irq_handler_t dma_irq_handler;
+static irq_handler_t i2c_irq_handlers[NUM_I2CS];
+
+static bool gpio_levels[30];
+
+static uint16_t pwm_levels[30];
+static uint32_t pwm_irq_enabled_mask;
+static uint32_t pwm_irq_status;
+static irq_handler_t pwm_irq_handler;
+
+void mock_bus_reset(void)
+{
+  mock_bus.transactions = 0;
+  mock_bus.bytes = 0;
+  mock_bus.recorded_length = 0;
+  mock_bus_ports[0] = mock_bus_ports[1] = mock_bus;
+}
+
+// Guarda o byte na gravação, até MOCK_BUS_RECORD_SIZE bytes por reset
+static void mock_bus_record(uint8_t byte)
+{
+  if (mock_bus.recorded_length < MOCK_BUS_RECORD_SIZE)
+    mock_bus.recorded[mock_bus.recorded_length++] = byte;
+}
+
+double mock_bus_time_us(const mock_bus_stats_t *stats, unsigned baudrate)
+{
+  size_t bits = (stats->bytes + stats->transactions) * 9;
+  return bits * 1e6 / baudrate;
+}
+
+uint64_t mock_clock_step_us;
+static uint64_t mock_clock_us;
+
+absolute_time_t get_absolute_time(void)
+{
+  if (mock_clock_step_us)
+    return mock_clock_us += mock_clock_step_us;
+
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (absolute_time_t)now.tv_sec * 1000000u + now.tv_nsec / 1000;
+}
+
+void sleep_us(uint64_t us)
+{
+  if (mock_clock_step_us)
+  {
+    mock_clock_us += us;
+    return;
+  }
+  struct timespec duration = {(time_t)(us / 1000000u), (long)(us % 1000000u) * 1000};
+  nanosleep(&duration, NULL);
+}
+
+void sleep_ms(uint32_t ms)
+{
+  sleep_us((uint64_t)ms * 1000u);
+}
+
+void gpio_init(uint gpio)
+{
+  (void)gpio;
+}
+
+void gpio_set_dir(uint gpio, bool out)
+{
+  (void)gpio;
+  (void)out;
+}
+
+void gpio_put(uint gpio, bool value)
+{
+  gpio_levels[gpio] = value;
+}
+
+bool gpio_get(uint gpio)
+{
+  return gpio_levels[gpio];
+}
+
+void gpio_set_function(uint gpio, uint fn)
+{
+  (void)gpio;
+  (void)fn;
+}
+
+uint i2c_init(i2c_inst_t *i2c, uint baudrate)
+{
+  i2c->hw.status = I2C_IC_STATUS_TFE_BITS;
+  return baudrate;
+}
+
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop)
+{
+  (void)addr;
+  (void)nostop;
+  mock_bus_stats_t *port = &mock_bus_ports[i2c == i2c0 ? 0 : 1];
+  mock_bus.transactions++;
+  mock_bus.bytes += len;
+  port->transactions++;
+  port->bytes += len;
+  for (size_t i = 0; i < len; ++i)
+    mock_bus_record(src[i]);
+  return (int)len;
+}
+
+i2c_hw_t *i2c_get_hw(i2c_inst_t *i2c)
+{
+  i2c->hw.status = i2c->draining ? I2C_IC_STATUS_MST_ACTIVITY_BITS : I2C_IC_STATUS_TFE_BITS;
+  return &i2c->hw;
+}
+
+uint i2c_hw_index(i2c_inst_t *i2c)
+{
+  return i2c == i2c0 ? 0 : 1;
+}
+
+uint i2c_get_dreq(i2c_inst_t *i2c, bool is_tx)
+{
+  return (i2c == i2c0 ? 32 : 34) + (is_tx ? 0 : 1);
+}
+
+uint spi_init(spi_inst_t *spi, uint baudrate)
+{
+  (void)spi;
+  return baudrate;
+}
+
+// Cada escrita conta como uma transação (um período com o CS baixo); as
+// contagens por porta (mock_bus_ports) são só do I2C
+int spi_write_blocking(spi_inst_t *spi, const uint8_t *src, size_t len)
+{
+  (void)spi;
+  mock_bus.transactions++;
+  mock_bus.bytes += len;
+  for (size_t i = 0; i < len; ++i)
+    mock_bus_record(src[i]);
+  return (int)len;
+}
+
+bool spi_is_busy(const spi_inst_t *spi)
+{
+  (void)spi;
+  return false;
+}
+
+spi_hw_t *spi_get_hw(spi_inst_t *spi)
+{
+  return &spi->hw;
+}
+
+uint spi_get_index(const spi_inst_t *spi)
+{
+  return spi == spi0 ? 0 : 1;
+}
+
+uint spi_get_dreq(spi_inst_t *spi, bool is_tx)
+{
+  return (spi == spi0 ? 16 : 18) + (is_tx ? 0 : 1);
+}
+
+int dma_claim_unused_channel(bool required)
+{
+  (void)required;
+  for (int channel = 0; channel < NUM_DMA_CHANNELS; ++channel)
+  {
+    if (!dma_claimed[channel])
+    {
+      dma_claimed[channel] = true;
+      return channel;
+    }
+  }
+  return -1;
+}
+
+void dma_channel_unclaim(uint channel)
+{
+  dma_claimed[channel] = false;
+}
+
+dma_channel_config dma_channel_get_default_config(uint channel)
+{
+  (void)channel;
+  dma_channel_config config = {0};
+  return config;
+}
+
+void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size)
+{
+  c->ctrl = (c->ctrl & ~3u) | (uint32_t)size;
+}
+
+void channel_config_set_read_increment(dma_channel_config *c, bool incr)
+{
+  (void)c;
+  (void)incr;
+}
+
+void channel_config_set_write_increment(dma_channel_config *c, bool incr)
+{
+  (void)c;
+  (void)incr;
+}
+
+void channel_config_set_dreq(dma_channel_config *c, uint dreq)
+{
+  (void)c;
+  (void)dreq;
+}
+
+// Entrega as entradas de IC_DATA_CMD ao barramento simulado: cada bit de
+// STOP encerra uma transação. Transferências de 8 bits (SPI) são uma
+// transação só. No I2C a interrupção do DMA roda com os últimos bytes ainda
+// "na FIFO" (controlador ativo, sem o STOP final); depois dela o STOP sai e,
+// se ela liberou a interrupção de STOP, o handler do controlador roda.
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, uint transfer_count, bool trigger)
+{
+  if (!trigger)
+    return;
+
+  mock_bus_stats_t *port = &mock_bus_ports[write_addr == &i2c0->hw.data_cmd ? 0 : 1];
+  i2c_inst_t *i2c = NULL;
+  if (write_addr == &i2c0->hw.data_cmd)
+    i2c = i2c0;
+  else if (write_addr == &i2c1->hw.data_cmd)
+    i2c = i2c1;
+
+  if ((config->ctrl & 3u) == DMA_SIZE_16)
+  {
+    const volatile uint16_t *entries = read_addr;
+    for (uint i = 0; i < transfer_count; ++i)
+    {
+      mock_bus.bytes++;
+      port->bytes++;
+      mock_bus_record((uint8_t)entries[i]);
+      if ((entries[i] & I2C_IC_DATA_CMD_STOP_BITS) && i + 1 < transfer_count)
+      {
+        mock_bus.transactions++;
+        port->transactions++;
+        if (i2c)
+          i2c->hw.raw_intr_stat |= I2C_IC_RAW_INTR_STAT_STOP_DET_BITS;
+      }
+    }
+  }
+  else if ((config->ctrl & 3u) == DMA_SIZE_8)
+  {
+    const volatile uint8_t *bytes = read_addr;
+    mock_bus.transactions++;
+    mock_bus.bytes += transfer_count;
+    for (uint i = 0; i < transfer_count; ++i)
+      mock_bus_record(bytes[i]);
+  }
+
+  if (i2c)
+    i2c->draining = true;
+  if (dma_irq0_enabled[channel])
+  {
+    dma_irq0_status[channel] = true;
+    if (dma_irq_handler)
+      dma_irq_handler();
+  }
+
+  if (i2c)
+  {
+    i2c->draining = false;
+    const volatile uint16_t *entries = read_addr;
+    if (transfer_count && (entries[transfer_count - 1] & I2C_IC_DATA_CMD_STOP_BITS))
+    {
+      mock_bus.transactions++;
+      port->transactions++;
+      i2c->hw.raw_intr_stat |= I2C_IC_RAW_INTR_STAT_STOP_DET_BITS;
+    }
+    if ((i2c->hw.intr_mask & i2c->hw.raw_intr_stat) && i2c_irq_handlers[i2c_hw_index(i2c)])
+      i2c_irq_handlers[i2c_hw_index(i2c)]();
+  }
+}
+
+bool dma_channel_is_busy(uint channel)
+{
+  (void)channel;
+  return false;
+}
+
+void dma_channel_abort(uint channel)
+{
+  (void)channel;
+}
+
+void dma_channel_set_irq0_enabled(uint channel, bool enabled)
+{
+  dma_irq0_enabled[channel] = enabled;
+}
+
+bool dma_channel_get_irq0_status(uint channel)
+{
+  return dma_irq0_status[channel];
+}
+
+void dma_channel_acknowledge_irq0(uint channel)
+{
+  dma_irq0_status[channel] = false;
+}
+
+void irq_add_shared_handler(uint num, irq_handler_t handler, uint8_t order_priority)
+{
+  (void)order_priority;
+  if (num == DMA_IRQ_0)
+    dma_irq_handler = handler;
+  else if (num == PWM_IRQ_WRAP)
+    pwm_irq_handler = handler;
+  else if (num == I2C0_IRQ || num == I2C1_IRQ)
+    i2c_irq_handlers[num - I2C0_IRQ] = handler;
+}
+
+void irq_set_enabled(uint num, bool enabled)
+{
+  (void)num;
+  (void)enabled;
+}
+
+void pwm_init(uint slice_num, pwm_config *c, bool start)
+{
+  (void)slice_num;
+  (void)c;
+  (void)start;
+}
+
+void pwm_set_gpio_level(uint gpio, uint16_t level)
+{
+  if (gpio < sizeof(pwm_levels) / sizeof(pwm_levels[0]))
+    pwm_levels[gpio] = level;
+}
+
+uint32_t pwm_get_irq_status_mask(void)
+{
+  return pwm_irq_status;
+}
+
+void pwm_clear_irq(uint slice_num)
+{
+  pwm_irq_status &= ~(1u << slice_num);
+}
+
+void pwm_set_irq_enabled(uint slice_num, bool enabled)
+{
+  if (enabled)
+    pwm_irq_enabled_mask |= 1u << slice_num;
+  else
+    pwm_irq_enabled_mask &= ~(1u << slice_num);
+}
+
+uint16_t mock_pwm_level(unsigned gpio)
+{
+  return gpio < sizeof(pwm_levels) / sizeof(pwm_levels[0]) ? pwm_levels[gpio] : 0;
+}
+
+bool mock_pwm_irq_enabled(unsigned slice)
+{
+  return pwm_irq_enabled_mask & (1u << slice);
+}
+
+unsigned mock_pwm_wrap(unsigned count)
+{
+  unsigned serviced = 0;
+  for (unsigned i = 0; i < count; ++i)
+  {
+    if (!pwm_irq_enabled_mask)
+      continue;
+    pwm_irq_status |= pwm_irq_enabled_mask;
+    serviced++;
+    if (pwm_irq_handler)
+      pwm_irq_handler();
+  }
+  return serviced;
+}
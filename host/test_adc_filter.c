@@ -0,0 +1,151 @@
+// Testes do decimador do ADC (bibliotecas/adc_filter.c) com um fluxo de
+// amostras gravado em memória: ruído em volta de uma rampa, intercalado como
+// o DMA escreve (y, x, y, x, ...). O resultado não pode depender de como o
+// fluxo foi partido entre as chamadas nem de onde o anel deu a volta.
+#include <stdio.h>
+#include <stdlib.h>
+#include "bibliotecas/adc_filter.h"
+
+#define SAMPLES 8192
+#define RING_SIZE 64
+#define OVERSAMPLE 8
+
+static uint16_t stream[SAMPLES];
+static unsigned failures;
+
+static void check(bool ok, const char *name)
+{
+  printf("%-48s %s\n", name, ok ? "ok" : "FALHOU");
+  if (!ok)
+    failures++;
+}
+
+// Média arredondada da janela `index` do canal, direto do fluxo
+static uint16_t reference(uint8_t channel, uint32_t index, uint16_t oversample)
+{
+  uint32_t sum = 0;
+  for (uint16_t j = 0; j < oversample; ++j)
+    sum += stream[(index * oversample + j) * ADC_FILTER_CHANNELS + channel] & 0x0FFF;
+  return (sum + oversample / 2) / oversample;
+}
+
+// O último canal tem a janela do valor completo mais recente; os anteriores
+// podem já ter fechado a janela seguinte se o pedaço acabou no meio dela
+static bool matches_reference(const adc_filter_t *filter)
+{
+  if (filter->outputs == 0)
+    return false;
+  uint32_t last = filter->outputs - 1;
+  for (uint8_t channel = 0; channel < ADC_FILTER_CHANNELS; ++channel)
+  {
+    uint16_t output = filter->output[channel];
+    bool next = channel < ADC_FILTER_CHANNELS - 1 && (last + 2) * filter->oversample * ADC_FILTER_CHANNELS <= SAMPLES &&
+                output == reference(channel, last + 1, filter->oversample);
+    if (output != reference(channel, last, filter->oversample) && !next)
+      return false;
+  }
+  return true;
+}
+
+// Sinal constante: a média é o próprio valor; os 4 bits altos são ignorados
+static void test_constant(void)
+{
+  adc_filter_t filter;
+  adc_filter_init(&filter, 4);
+  const uint16_t samples[] = {0xF7D0, 1000, 2000, 1000, 2000, 1000, 2000, 1000};
+  uint32_t produced = adc_filter_push(&filter, samples, 8, 0);
+  check(produced == 1 && filter.output[0] == 2000 && filter.output[1] == 1000,
+        "sinal constante, bits altos descartados");
+}
+
+// Fluxo inteiro de uma vez e em pedaços de tamanho aleatório (ímpares
+// também, para o canal inicial variar): mesmas saídas e mesma contagem
+static void test_chunks(void)
+{
+  adc_filter_t whole;
+  adc_filter_init(&whole, OVERSAMPLE);
+  uint32_t produced = adc_filter_push(&whole, stream, SAMPLES, 0);
+  check(produced == SAMPLES / (ADC_FILTER_CHANNELS * OVERSAMPLE) && whole.outputs == produced &&
+            matches_reference(&whole),
+        "fluxo inteiro contra a média direta");
+
+  adc_filter_t chunked;
+  adc_filter_init(&chunked, OVERSAMPLE);
+  uint32_t total = 0;
+  bool each_ok = true;
+  for (size_t i = 0; i < SAMPLES;)
+  {
+    size_t count = 1 + rand() % 37;
+    if (count > SAMPLES - i)
+      count = SAMPLES - i;
+    uint32_t before = chunked.outputs;
+    uint32_t got = adc_filter_push(&chunked, &stream[i], count, i % ADC_FILTER_CHANNELS);
+    total += got;
+    // Um valor novo em cada chamada que fecha uma janela, e sempre o certo
+    if (got != chunked.outputs - before || (got && !matches_reference(&chunked)))
+      each_ok = false;
+    i += count;
+  }
+  check(each_ok && total == produced && chunked.output[0] == whole.output[0] && chunked.output[1] == whole.output[1],
+        "fluxo em pedaços aleatórios");
+}
+
+// Anel como o do adc_sampler: o "DMA" escreve um pedaço, o consumidor drena
+// de read_index até write_index. Conta os valores e confere que cada
+// drenagem que fecha uma janela avisa, mesmo quando ela fecha antes da volta
+static void test_ring(void)
+{
+  static uint16_t ring[RING_SIZE];
+  adc_filter_t filter;
+  adc_filter_init(&filter, OVERSAMPLE);
+
+  size_t read_index = 0, write_index = 0;
+  uint32_t total = 0;
+  bool each_ok = true;
+  for (size_t i = 0; i < SAMPLES;)
+  {
+    size_t count = 1 + rand() % (RING_SIZE - 1);
+    if (count > SAMPLES - i)
+      count = SAMPLES - i;
+    for (size_t j = 0; j < count; ++j)
+    {
+      ring[write_index] = stream[i + j];
+      write_index = (write_index + 1) % RING_SIZE;
+    }
+    i += count;
+
+    uint32_t before = filter.outputs;
+    uint32_t got = adc_filter_push_ring(&filter, ring, RING_SIZE, read_index, write_index);
+    read_index = write_index;
+    total += got;
+    if (got != filter.outputs - before || (got && !matches_reference(&filter)))
+      each_ok = false;
+  }
+  check(each_ok && total == SAMPLES / (ADC_FILTER_CHANNELS * OVERSAMPLE), "anel com voltas em pontos aleatórios");
+
+  // Janela que fecha exatamente no fim do anel, sem nada depois da volta:
+  // o trecho antes da volta produz o valor e a drenagem tem que avisar
+  adc_filter_init(&filter, 4);
+  for (size_t j = 0; j < RING_SIZE; ++j)
+    ring[j] = stream[j];
+  uint32_t first = adc_filter_push_ring(&filter, ring, RING_SIZE, 0, RING_SIZE - 8);
+  uint32_t wrap = adc_filter_push_ring(&filter, ring, RING_SIZE, RING_SIZE - 8, 0);
+  check(first == (RING_SIZE - 8) / 8 && wrap == 1 && filter.output[1] == reference(1, RING_SIZE / 8 - 1, 4),
+        "janela fechada só no trecho antes da volta");
+}
+
+int main(void)
+{
+  srand(1);
+  for (size_t i = 0; i < SAMPLES; i += ADC_FILTER_CHANNELS)
+  {
+    uint16_t ramp = (uint16_t)(i * 4095 / SAMPLES);
+    stream[i] = (uint16_t)(ramp + rand() % 64 - 32) & 0x0FFF;
+    stream[i + 1] = (uint16_t)(4095 - ramp + rand() % 64 - 32) & 0x0FFF;
+  }
+
+  test_constant();
+  test_chunks();
+  test_ring();
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,210 @@
+// Testes das animações comprimidas (bibliotecas/animation.c). Com o Python,
+// o gerador e um diretório como argumentos, faz a ida e volta: grava quadros
+// no formato do Piskel, gera o array com "Criar letras e animações via
+// priskel.py" --animacao e confere cada quadro decodificado, em duas voltas,
+// com o modelo, inclusive a região marcada e os bytes fora da animação. Sem
+// argumentos, só confere que quadros truncados não são lidos além do tamanho
+// declarado.
+//
+//   ./build-host/host/test_animation python3 "Criar letras e animações via priskel.py" build-host/host/animation
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "bibliotecas/ssd1306.h"
+#include "bibliotecas/animation.h"
+
+#define ANIM_WIDTH 64  // 192 bytes por quadro: literais e trechos passam de 128
+#define ANIM_HEIGHT 20 // Última página pela metade
+#define ANIM_PAGES ((ANIM_HEIGHT + 7) / 8)
+#define ANIM_FRAMES 12
+#define ANIM_X 30
+#define ANIM_PAGE 2
+#define GENERATED_SIZE 8192
+
+static ssd1306_t ssd;
+static uint8_t background[SSD1306_BUFFER_SIZE(WIDTH, HEIGHT)];
+static uint8_t before[SSD1306_BUFFER_SIZE(WIDTH, HEIGHT)];
+static uint8_t generated[GENERATED_SIZE];
+static unsigned failures;
+
+static void check(bool ok, const char *name)
+{
+  printf("%-52s %s\n", name, ok ? "ok" : "FALHOU");
+  if (!ok)
+    failures++;
+}
+
+// Quadros do modelo: ruído (quadro-chave só com literais), apagado duas vezes
+// (XOR de ruído e XOR vazio), faixas de 4 linhas (todo byte 0x0F, mesmo na
+// última página: trecho de 192) e um retângulo que anda
+static bool model_pixel(unsigned frame, unsigned x, unsigned y)
+{
+  switch (frame)
+  {
+  case 0:
+    return ((x * 7919u + y * 104729u) ^ (x * y * 31u)) % 3 == 0;
+  case 1:
+  case 2:
+    return false;
+  case 3:
+    return y % 8 < 4;
+  default:
+  {
+    unsigned left = (frame - 4) * 7, top = (frame - 4) * 2;
+    return x >= left && x < left + 10 && y >= top && y < top + 7;
+  }
+  }
+}
+
+static bool write_piskel(const char *path)
+{
+  FILE *file = fopen(path, "w");
+  if (!file)
+    return false;
+  for (unsigned frame = 0; frame < ANIM_FRAMES; ++frame)
+  {
+    fputs("{\n", file);
+    for (unsigned y = 0; y < ANIM_HEIGHT; ++y)
+    {
+      for (unsigned x = 0; x < ANIM_WIDTH; ++x)
+        fprintf(file, "0x%s, ", model_pixel(frame, x, y) ? "ff0000ff" : "ff000000");
+      fputc('\n', file);
+    }
+    fputs("},\n", file);
+  }
+  return fclose(file) == 0;
+}
+
+// Roda o gerador e lê os bytes do array impresso por ele
+static size_t run_generator(const char *python, const char *script, const char *input)
+{
+  char command[1024];
+  snprintf(command, sizeof(command), "\"%s\" \"%s\" --animacao \"%s\" --largura %d --altura %d --intervalo 50", python,
+           script, input, ANIM_WIDTH, ANIM_HEIGHT);
+  FILE *pipe = popen(command, "r");
+  if (!pipe)
+    return 0;
+
+  size_t length = 0;
+  bool inside = false;
+  int c;
+  while ((c = fgetc(pipe)) != EOF)
+  {
+    if (c == '{' || c == '}')
+      inside = c == '{';
+    else if (inside && c == 'x' && length < GENERATED_SIZE)
+    {
+      unsigned value;
+      if (fscanf(pipe, "%2x", &value) == 1)
+        generated[length++] = value;
+    }
+  }
+  return pclose(pipe) == 0 ? length : 0;
+}
+
+// Confere o quadro decodificado: a região da animação igual ao modelo (linhas
+// depois de ANIM_HEIGHT apagadas), o resto do buffer intacto e todo byte
+// alterado dentro da região marcada
+static bool frame_matches(unsigned frame)
+{
+  for (uint8_t x = 0; x < ssd.width; ++x)
+  {
+    for (uint8_t page = 0; page < ssd.pages; ++page)
+    {
+      uint16_t i = ssd1306_index(&ssd, x, page);
+      bool inside = x >= ANIM_X && x < ANIM_X + ANIM_WIDTH && page >= ANIM_PAGE && page < ANIM_PAGE + ANIM_PAGES;
+      uint8_t expected = background[i];
+      if (inside)
+      {
+        expected = 0;
+        for (uint8_t bit = 0; bit < 8; ++bit)
+        {
+          unsigned y = (page - ANIM_PAGE) * 8 + bit;
+          if (y < ANIM_HEIGHT && model_pixel(frame, x - ANIM_X, y))
+            expected |= 1 << bit;
+        }
+      }
+      bool marked = x >= ssd.dirty_x0 && x <= ssd.dirty_x1 && page >= ssd.dirty_page0 && page <= ssd.dirty_page1;
+      if (ssd.ram_buffer[i] != expected || (ssd.ram_buffer[i] != before[i] && !marked))
+        return false;
+    }
+  }
+  return true;
+}
+
+static void round_trip(const char *python, const char *script, const char *dir)
+{
+  char command[600], path[512];
+  snprintf(command, sizeof(command), "mkdir -p '%s'", dir);
+  snprintf(path, sizeof(path), "%s/quadros.c", dir);
+  if (system(command) != 0 || !write_piskel(path))
+  {
+    check(false, "gravar os quadros do modelo");
+    return;
+  }
+  size_t length = run_generator(python, script, path);
+  printf("  %u quadros de %ux%u: %u bytes em %zu\n", ANIM_FRAMES, ANIM_WIDTH, ANIM_HEIGHT,
+         ANIM_FRAMES * ANIM_WIDTH * ANIM_PAGES, length);
+
+  animation_t anim;
+  check(length > 0 && animation_init(&anim, generated) && anim.width == ANIM_WIDTH && anim.pages == ANIM_PAGES &&
+            anim.frame_count == ANIM_FRAMES && anim.interval_ms == 50,
+        "cabeçalho gerado");
+  if (failures)
+    return;
+
+  for (size_t i = 1; i < ssd.bufsize; ++i)
+    ssd.ram_buffer[i] = background[i] = rand();
+
+  bool frames_ok = true, changed_ok = true;
+  for (unsigned n = 0; n < 2 * ANIM_FRAMES; ++n)
+  {
+    memcpy(before, ssd.ram_buffer, ssd.bufsize);
+    ssd1306_clear_dirty(&ssd);
+    bool changed = animation_next_frame(&anim, &ssd, ANIM_X, ANIM_PAGE);
+    frames_ok &= frame_matches(n % ANIM_FRAMES);
+    changed_ok &= changed == (memcmp(before, ssd.ram_buffer, ssd.bufsize) != 0);
+  }
+  check(frames_ok, "ida e volta: quadros iguais ao modelo em duas voltas");
+  check(changed_ok, "retorno indica se algum byte mudou");
+}
+
+// Quadro-chave de 4 bytes numa página com o tamanho declarado `size`; os
+// bytes depois dele são 0xAA e não podem aparecer no buffer
+static void truncated(const uint8_t *data, uint8_t size, const char *name)
+{
+  uint8_t stream[8 + 3 + 16] = {'A', 'N', 4, 1, 1, 0, 100, 0, 0x01, size, 0};
+  memset(stream + 11, 0xAA, sizeof(stream) - 11);
+  memcpy(stream + 11, data, size);
+
+  animation_t anim;
+  ssd1306_fill(&ssd, false);
+  animation_init(&anim, stream);
+  animation_next_frame(&anim, &ssd, 0, 0);
+  bool clean = true;
+  for (uint8_t x = 0; x < 4; ++x)
+  {
+    uint8_t expected = x < size - 1 ? data[x + 1] : 0;
+    clean &= ssd.ram_buffer[ssd1306_index(&ssd, x, 0)] == expected;
+  }
+  check(clean, name);
+}
+
+int main(int argc, char **argv)
+{
+  ssd1306_init(&ssd, WIDTH, HEIGHT, false, 0x3C, NULL);
+  srand(1);
+
+  // Literal de 10 bytes com só 2 no quadro, e trecho sem o byte do valor
+  const uint8_t literal[] = {0x09, 0x11, 0x22};
+  const uint8_t run[] = {0x83};
+  truncated(literal, sizeof(literal), "literal truncado lê só o quadro");
+  truncated(run, sizeof(run), "trecho sem valor no fim do quadro é ignorado");
+
+  if (argc > 3)
+    round_trip(argv[1], argv[2], argv[3]);
+
+  return failures ? 1 : 0;
+}
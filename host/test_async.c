@@ -0,0 +1,112 @@
+// Testes do envio assíncrono (ssd1306_async_init e *_async) no barramento
+// I2C simulado: o buffer frontal recebe a transação completa no formato do
+// IC_DATA_CMD, o ram_buffer fica livre para o próximo quadro logo depois da
+// chamada sem alterar o que está no buffer frontal, e o callback vem uma vez
+// por envio.
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "bibliotecas/ssd1306.h"
+#include "mock_bus.h"
+
+#define WINDOW_ENTRIES 8 // 0x00 + SET_COL_ADDR x0 x1 + SET_PAGE_ADDR p0 p1 + 0x40
+#define FRONT_ENTRIES (WINDOW_ENTRIES + WIDTH * HEIGHT / 8)
+
+static ssd1306_t ssd;
+static uint16_t snapshot[FRONT_ENTRIES];
+static unsigned callbacks;
+static unsigned failures;
+
+static void check(bool ok, const char *name)
+{
+  printf("%-48s %s\n", name, ok ? "ok" : "FALHOU");
+  if (!ok)
+    failures++;
+}
+
+static void on_flush_done(ssd1306_t *display)
+{
+  (void)display;
+  callbacks++;
+}
+
+// Janela e dados no buffer frontal: comandos terminados em STOP, 0x40 e os
+// bytes do ram_buffer coluna a coluna, o último também com STOP
+static bool front_matches(uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1)
+{
+  const uint16_t header[WINDOW_ENTRIES] = {
+      0x00, SET_COL_ADDR, x0, x1, SET_PAGE_ADDR, page0, page1 | I2C_IC_DATA_CMD_STOP_BITS, 0x40};
+  if (memcmp(ssd.dma_buffer, header, sizeof(header)) != 0)
+    return false;
+
+  size_t n = WINDOW_ENTRIES;
+  size_t last = WINDOW_ENTRIES + (x1 - x0 + 1) * (page1 - page0 + 1) - 1;
+  for (uint16_t x = x0; x <= x1; ++x)
+  {
+    for (uint8_t page = page0; page <= page1; ++page, ++n)
+    {
+      uint16_t expected = ssd.ram_buffer[ssd1306_index(&ssd, x, page)] | (n == last ? I2C_IC_DATA_CMD_STOP_BITS : 0);
+      if (ssd.dma_buffer[n] != expected)
+        return false;
+    }
+  }
+  return true;
+}
+
+int main(void)
+{
+  i2c_init(i2c1, 400 * 1000);
+  ssd1306_init(&ssd, WIDTH, HEIGHT, false, 0x3C, i2c1);
+
+  // Sem DMA os envios *_async bloqueiam e mandam os mesmos bytes
+  ssd1306_send_data(&ssd);
+  ssd1306_pixel(&ssd, 70, 29, true);
+  mock_bus_reset();
+  ssd1306_send_dirty_async(&ssd);
+  check(mock_bus.bytes == WINDOW_ENTRIES + 1 && mock_bus.transactions == 2 && ssd.dirty_x0 > ssd.dirty_x1,
+        "sem DMA: send_dirty_async bloqueante");
+
+  check(ssd1306_async_init(&ssd, on_flush_done), "async_init");
+
+  // Quadro N inteiro no buffer frontal
+  draw_border(&ssd, 3);
+  mock_bus_reset();
+  ssd1306_send_data_async(&ssd);
+  ssd1306_wait_flush(&ssd);
+  check(front_matches(0, WIDTH - 1, 0, HEIGHT / 8 - 1), "quadro inteiro no formato do IC_DATA_CMD");
+  check(mock_bus.bytes == WINDOW_ENTRIES + WIDTH * HEIGHT / 8 && mock_bus.transactions == 2,
+        "quadro inteiro: 1032 bytes em 2 transações");
+  check(callbacks == 1 && ssd.dirty_x0 > ssd.dirty_x1, "um callback, região alterada vazia");
+
+  // Quadro N+1 desenhado no ram_buffer logo depois: o frontal não muda
+  memcpy(snapshot, ssd.dma_buffer, sizeof(snapshot));
+  ssd1306_fill(&ssd, true);
+  draw_border(&ssd, 1);
+  check(memcmp(snapshot, ssd.dma_buffer, sizeof(snapshot)) == 0, "desenhar no ram_buffer não altera o frontal");
+
+  // Só a região alterada vai no próximo envio
+  ssd1306_send_data_async(&ssd);
+  ssd1306_rect(&ssd, 20, 30, 16, 12, false, true);
+  mock_bus_reset();
+  uint8_t x0 = ssd.dirty_x0, x1 = ssd.dirty_x1, page0 = ssd.dirty_page0, page1 = ssd.dirty_page1;
+  ssd1306_send_dirty_async(&ssd);
+  size_t window = (size_t)(x1 - x0 + 1) * (page1 - page0 + 1);
+  check(front_matches(x0, x1, page0, page1) && mock_bus.bytes == WINDOW_ENTRIES + window,
+        "send_dirty_async: só a janela alterada");
+  check(callbacks == 3, "um callback por envio");
+
+  // Nada alterado: nenhum envio e nenhum callback
+  mock_bus_reset();
+  ssd1306_send_dirty_async(&ssd);
+  check(mock_bus.bytes == 0 && callbacks == 3 && !ssd1306_flush_busy(&ssd), "sem alteração, sem envio");
+
+  // Comando bloqueante depois de um envio: espera o envio e vai sozinho
+  ssd1306_pixel(&ssd, 0, 0, false);
+  ssd1306_send_dirty_async(&ssd);
+  mock_bus_reset();
+  ssd1306_command(&ssd, SET_DISP | 0x01);
+  check(mock_bus.bytes == 2 && mock_bus.transactions == 1, "comando bloqueante depois do envio");
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,62 @@
+// Bytes de ssd1306_config no barramento I2C simulado: a sequência de
+// inicialização inteira numa transação só (byte de controle 0x00 + comandos),
+// com MUX e pinos COM de acordo com a altura do display. Termina com erro se
+// algum byte for diferente.
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "bibliotecas/ssd1306.h"
+#include "mock_bus.h"
+
+static unsigned failures;
+
+static void check(bool ok, const char *name)
+{
+  printf("%-52s %s\n", name, ok ? "ok" : "FALHOU");
+  if (!ok)
+    failures++;
+}
+
+// Configura um display de width x height e compara com a sequência esperada,
+// que só muda no MUX (altura - 1) e na configuração dos pinos COM
+static void check_config(uint8_t width, uint8_t height, uint8_t com_pins, const char *name)
+{
+  const uint8_t expected[] = {
+      0x00, // Byte de controle: todos os bytes seguintes são comandos
+      SET_DISP | 0x00,
+      SET_MEM_ADDR, 0x01,
+      SET_DISP_START_LINE | 0x00,
+      SET_SEG_REMAP | 0x01,
+      SET_MUX_RATIO, height - 1,
+      SET_COM_OUT_DIR | 0x08,
+      SET_DISP_OFFSET, 0x00,
+      SET_COM_PIN_CFG, com_pins,
+      SET_DISP_CLK_DIV, 0x80,
+      SET_PRECHARGE, 0xF1,
+      SET_VCOM_DESEL, 0x30,
+      SET_CONTRAST, 0xFF,
+      SET_ENTIRE_ON,
+      SET_NORM_INV,
+      SET_CHARGE_PUMP, 0x14,
+      SET_DISP | 0x01};
+
+  static ssd1306_t ssd;
+  ssd1306_init(&ssd, width, height, false, 0x3C, i2c1);
+  mock_bus_reset();
+  ssd1306_config(&ssd);
+
+  check(mock_bus.transactions == 1 && mock_bus.bytes == sizeof(expected) &&
+            mock_bus.recorded_length == sizeof(expected) &&
+            memcmp(mock_bus.recorded, expected, sizeof(expected)) == 0,
+        name);
+}
+
+int main(void)
+{
+  i2c_init(i2c1, 400 * 1000);
+
+  check_config(128, 64, 0x12, "128x64: pinos COM alternativos (0x12)");
+  check_config(128, 32, 0x02, "128x32: pinos COM sequenciais (0x02)");
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,236 @@
+// Testes da captura do framebuffer (bibliotecas/fb_capture.c): os quadros
+// codificados como delta são decodificados aqui e comparados com o
+// ram_buffer de cada quadro enviado, com quadros-chave, descartes com a
+// saída lenta e quadros de pior caso. Com um diretório como argumento grava
+// também a captura (capture.bin, com texto do stdio misturado) e o PBM
+// esperado de cada quadro, para o teste fb_capture_replay conferir
+// host/decode_fbcapture.py --golden.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "bibliotecas/ssd1306.h"
+#include "bibliotecas/fb_capture.h"
+
+#define FRAMES 320
+#define STREAM_SIZE (1 << 20)
+
+static ssd1306_t ssd;
+static fb_capture_t capture;
+static uint8_t stream[STREAM_SIZE];
+static size_t stream_length, write_limit;
+static uint8_t decoded[FB_CAPTURE_MAX_FRAME];
+static uint16_t expected_sequence;
+static const char *output_dir;
+static unsigned golden_frames;
+static unsigned failures;
+
+static void check(bool ok, const char *name)
+{
+  printf("%-48s %s\n", name, ok ? "ok" : "FALHOU");
+  if (!ok)
+    failures++;
+}
+
+static size_t write_stream(void *context, const uint8_t *data, size_t len)
+{
+  (void)context;
+  size_t accepted = len < write_limit ? len : write_limit;
+  if (accepted > STREAM_SIZE - stream_length)
+    accepted = STREAM_SIZE - stream_length;
+  memcpy(&stream[stream_length], data, accepted);
+  stream_length += accepted;
+  return accepted;
+}
+
+static uint16_t get_u16(const uint8_t *in)
+{
+  return in[0] | (in[1] << 8);
+}
+
+// Decodifica o quadro em stream[offset] sobre `decoded`. Retorna o tamanho
+// do quadro, ou 0 se o cabeçalho, o Fletcher-16 ou a carga não conferem.
+static size_t decode_frame(size_t offset, bool *keyframe)
+{
+  const uint8_t *in = &stream[offset];
+  if (in[0] != 'F' || in[1] != 'B' || get_u16(&in[2]) != expected_sequence)
+    return 0;
+  uint16_t size = in[8] * in[9];
+  uint16_t payload = get_u16(&in[13]);
+  if (size > FB_CAPTURE_MAX_FRAME || payload > FB_CAPTURE_MAX_PAYLOAD)
+    return 0;
+
+  uint16_t sum1 = 0, sum2 = 0;
+  for (size_t i = 0; i < (size_t)FB_CAPTURE_HEADER_SIZE + payload; ++i)
+  {
+    sum1 = (sum1 + in[i]) % 255;
+    sum2 = (sum2 + sum1) % 255;
+  }
+  if (in[FB_CAPTURE_HEADER_SIZE + payload] != sum1 || in[FB_CAPTURE_HEADER_SIZE + payload + 1] != sum2)
+    return 0;
+
+  *keyframe = in[10] & FB_CAPTURE_FLAG_KEYFRAME;
+  if (*keyframe)
+    memset(decoded, 0, size);
+  const uint8_t *token = &in[FB_CAPTURE_HEADER_SIZE];
+  const uint8_t *end = token + payload;
+  uint16_t i = 0;
+  while (token < end)
+  {
+    uint8_t n = *token++;
+    if (n >= 0x80)
+    {
+      i += n - 0x7F;
+      continue;
+    }
+    for (uint16_t k = 0; k <= n; ++k)
+      decoded[i++] ^= *token++;
+  }
+  if (i != size)
+    return 0;
+  expected_sequence++;
+  return FB_CAPTURE_HEADER_SIZE + payload + 2;
+}
+
+// PBM do quadro (pixel aceso em branco, bit 0), como o decodificador grava
+static void write_golden(void)
+{
+  char path[512];
+  snprintf(path, sizeof(path), "%s/golden/quadro_%06u.pbm", output_dir, golden_frames++);
+  FILE *file = fopen(path, "wb");
+  if (!file)
+  {
+    printf("não foi possível gravar %s\n", path);
+    failures++;
+    return;
+  }
+  fprintf(file, "P4\n%u %u\n", ssd.width, ssd.height);
+  for (uint8_t y = 0; y < ssd.height; ++y)
+  {
+    for (uint8_t x = 0; x < ssd.width; x += 8)
+    {
+      uint8_t byte = 0;
+      for (uint8_t bit = 0; bit < 8; ++bit)
+      {
+        if (!(ssd.ram_buffer[ssd1306_index(&ssd, x + bit, y >> 3)] & (1 << (y & 7))))
+          byte |= 0x80 >> bit;
+      }
+      fputc(byte, file);
+    }
+  }
+  fclose(file);
+}
+
+// Captura o quadro, drena tudo e confere a decodificação com o ram_buffer
+static bool capture_and_check(uint32_t timestamp_us, bool *keyframe, size_t *bytes)
+{
+  size_t start = stream_length;
+  if (!fb_capture_frame(&capture, &ssd, timestamp_us))
+    return false;
+  while (fb_capture_drain(&capture, write_stream, NULL) > 0)
+    ;
+  *bytes = decode_frame(start, keyframe);
+  if (output_dir)
+    write_golden();
+  return *bytes == stream_length - start && memcmp(decoded, ssd.ram_buffer + 1, ssd.bufsize - 1) == 0;
+}
+
+int main(int argc, char **argv)
+{
+  output_dir = argc > 1 ? argv[1] : NULL;
+  if (output_dir)
+  {
+    char command[600];
+    snprintf(command, sizeof(command), "mkdir -p '%s/golden'", output_dir);
+    if (system(command) != 0)
+      return 2;
+  }
+
+  srand(1);
+  ssd1306_init(&ssd, WIDTH, HEIGHT, false, 0x3C, NULL);
+  fb_capture_init(&capture);
+  write_limit = 64;
+
+  fb_capture_frame(&capture, &ssd, 0);
+  check(capture.captured == 0 && stream_length == 0, "desligada: nada codificado");
+  fb_capture_start(&capture);
+
+  // Cena do laço: borda, quadrado andando e texto; de vez em quando a borda
+  // muda (quadro quase todo diferente) ou texto do stdio entra no meio
+  bool all_match = true, keyframes_ok = true;
+  size_t delta_bytes = 0, max_bytes = 0;
+  for (unsigned n = 0; n < FRAMES; ++n)
+  {
+    if (n % 60 == 0)
+      draw_border_copy(&ssd, n / 60 % 6);
+    ssd1306_rect(&ssd, 20 + n % 40, 10 + n % 100, 8, 8, n & 1, true);
+    char text[16];
+    snprintf(text, sizeof(text), "%4u", n);
+    ssd1306_draw_string(&ssd, text, 90, 52);
+    if (output_dir && n % 37 == 0)
+    {
+      const char *noise = "FPS 50 estilo 3 F\n";
+      memcpy(&stream[stream_length], noise, strlen(noise));
+      stream_length += strlen(noise);
+    }
+
+    bool keyframe;
+    size_t bytes;
+    all_match &= capture_and_check(n * 20000, &keyframe, &bytes);
+    keyframes_ok &= keyframe == (n % FB_CAPTURE_KEYFRAME_INTERVAL == 0);
+    if (!keyframe)
+      delta_bytes += bytes;
+    if (bytes > max_bytes)
+      max_bytes = bytes;
+  }
+  check(all_match, "320 quadros decodificados iguais ao ram_buffer");
+  check(keyframes_ok, "quadro-chave a cada FB_CAPTURE_KEYFRAME_INTERVAL");
+  printf("  deltas: %.1f bytes por quadro em média, maior quadro %zu bytes\n",
+         (double)delta_bytes / (FRAMES - FRAMES / FB_CAPTURE_KEYFRAME_INTERVAL), max_bytes);
+
+  // Quadro igual ao anterior: só as sequências de "iguais" (1024 / 128)
+  bool keyframe;
+  size_t bytes;
+  bool same = capture_and_check(FRAMES * 20000, &keyframe, &bytes);
+  check(same && bytes == FB_CAPTURE_HEADER_SIZE + 8 + 2, "quadro repetido: 8 bytes de carga");
+
+  // Pior caso: ruído em todos os bytes cabe em FB_CAPTURE_MAX_PAYLOAD
+  for (size_t i = 1; i < ssd.bufsize; ++i)
+    ssd.ram_buffer[i] = rand() | 1;
+  bool noise = capture_and_check(FRAMES * 20000 + 1, &keyframe, &bytes);
+  check(noise && bytes <= FB_CAPTURE_HEADER_SIZE + FB_CAPTURE_MAX_PAYLOAD + 2, "ruído: carga dentro do máximo");
+
+  // Saída parada no meio de um quadro: os seguintes são descartados, e o que
+  // sai depois é o delta contra o último enviado, não contra os descartados
+  ssd1306_fill(&ssd, false);
+  size_t start = stream_length;
+  fb_capture_frame(&capture, &ssd, 1);
+  if (output_dir)
+    write_golden();
+  fb_capture_drain(&capture, write_stream, NULL);
+  uint32_t dropped = capture.dropped;
+  ssd1306_rect(&ssd, 0, 0, 64, 32, true, true);
+  bool refused = !fb_capture_frame(&capture, &ssd, 2) && !fb_capture_frame(&capture, &ssd, 3);
+  check(refused && capture.dropped == dropped + 2, "envio em andamento: 2 quadros descartados");
+  while (fb_capture_drain(&capture, write_stream, NULL) > 0)
+    ;
+  bool resumed = decode_frame(start, &keyframe) > 0;
+  resumed &= capture_and_check(4, &keyframe, &bytes) && !keyframe;
+  check(resumed, "depois do descarte o delta confere");
+
+  fb_capture_stop(&capture);
+  check(!fb_capture_frame(&capture, &ssd, 5), "parada: nada codificado");
+
+  if (output_dir)
+  {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/capture.bin", output_dir);
+    FILE *file = fopen(path, "wb");
+    bool written = file && fwrite(stream, 1, stream_length, file) == stream_length;
+    if (file)
+      fclose(file);
+    check(written, "capture.bin gravado");
+  }
+
+  return failures ? 1 : 0;
+}
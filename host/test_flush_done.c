@@ -0,0 +1,92 @@
+// Momento do callback do envio assíncrono (ssd1306_async_init): no I2C ele
+// vem da interrupção de STOP do controlador, depois que o STOP final saiu no
+// barramento simulado, e não da interrupção do DMA. Confere também que é
+// chamado uma vez por envio e que a interrupção de STOP volta mascarada. No
+// SPI, o CS sobe na interrupção do fim do DMA, com ou sem callback.
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "bibliotecas/ssd1306.h"
+#include "bibliotecas/ssd1306_spi.h"
+#include "mock_bus.h"
+
+static ssd1306_t ssd;
+#define SPI_CS_PIN 17
+
+static unsigned calls, calls_before_stop, spi_calls, spi_calls_cs_low;
+static unsigned failures;
+
+static void check(bool ok, const char *name)
+{
+  printf("%-44s %s\n", name, ok ? "ok" : "FALHOU");
+  if (!ok)
+    failures++;
+}
+
+static void on_flush_done(ssd1306_t *display)
+{
+  (void)display;
+  calls++;
+  // Todas as transações (comandos e dados) já terminaram com STOP e o
+  // controlador está parado com a FIFO vazia
+  i2c_hw_t *hw = i2c_get_hw(i2c1);
+  if (mock_bus.transactions != 2 || !(hw->status & I2C_IC_STATUS_TFE_BITS) ||
+      (hw->status & I2C_IC_STATUS_MST_ACTIVITY_BITS))
+    calls_before_stop++;
+}
+
+static void on_spi_flush_done(ssd1306_t *display)
+{
+  (void)display;
+  spi_calls++;
+  if (!gpio_get(SPI_CS_PIN))
+    spi_calls_cs_low++;
+}
+
+int main(void)
+{
+  i2c_init(i2c1, 400 * 1000);
+  ssd1306_init(&ssd, WIDTH, HEIGHT, false, 0x3C, i2c1);
+  bool ready = ssd1306_async_init(&ssd, on_flush_done);
+  check(ready, "async_init no I2C");
+
+  for (unsigned n = 0; n < 3; ++n)
+  {
+    mock_bus_reset();
+    ssd1306_pixel(&ssd, 10 + n, 10, true);
+    ssd1306_send_dirty_async(&ssd);
+    ssd1306_wait_flush(&ssd);
+  }
+  check(calls == 3, "um callback por envio");
+  check(calls_before_stop == 0, "callback só depois do STOP final");
+  check(i2c_get_hw(i2c1)->intr_mask == 0, "interrupção de STOP mascarada depois");
+
+  // Sem alteração não há envio nem callback
+  ssd1306_send_dirty_async(&ssd);
+  check(calls == 3, "nada alterado, nenhum callback");
+
+  // SPI: o fim do DMA sobe o CS e chama o callback. O CS é conferido antes
+  // de qualquer consulta a ssd1306_flush_busy.
+  static ssd1306_t spi_display;
+  static ssd1306_spi_t spi_context;
+  ssd1306_init(&spi_display, WIDTH, HEIGHT, false, 0, NULL);
+  ssd1306_spi_attach(&spi_display, &spi_context, spi0, 20, SPI_CS_PIN);
+  ready = ssd1306_async_init(&spi_display, on_spi_flush_done);
+  ssd1306_fill(&spi_display, true);
+  ssd1306_send_dirty_async(&spi_display);
+  check(ready && spi_calls == 1, "SPI: callback na interrupção do DMA");
+  check(spi_calls_cs_low == 0, "SPI: callback com o CS já alto");
+  check(gpio_get(SPI_CS_PIN) && !ssd1306_flush_busy(&spi_display), "SPI: CS alto sem consultar busy");
+
+  // Sem callback o CS também sobe na interrupção
+  static ssd1306_t spi_quiet;
+  static ssd1306_spi_t spi_quiet_context;
+  ssd1306_init(&spi_quiet, WIDTH, HEIGHT, false, 0, NULL);
+  ssd1306_spi_attach(&spi_quiet, &spi_quiet_context, spi1, 21, SPI_CS_PIN + 5);
+  ready = ssd1306_async_init(&spi_quiet, NULL);
+  ssd1306_fill(&spi_quiet, true);
+  ssd1306_send_dirty_async(&spi_quiet);
+  check(ready && gpio_get(SPI_CS_PIN + 5) && !ssd1306_flush_busy(&spi_quiet), "SPI sem callback: CS alto no fim");
+
+  return failures ? 1 : 0;
+}
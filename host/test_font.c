@@ -0,0 +1,215 @@
+// Testes da fonte Latin-1 (bibliotecas/font.c) e do texto proporcional:
+// cobertura do índice, coerência de left/width com as colunas acesas,
+// decodificação do UTF-8 (códigos fora do Latin-1 e sequências inválidas
+// viram '?') e ssd1306_draw_string comparado, sobre um quadro aleatório, com
+// um modelo que pinta glyph a glyph, inclusive a quebra de linha. Também
+// confere a região marcada e a GDDRAM simulada depois de send_dirty.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "bibliotecas/ssd1306.h"
+#include "bibliotecas/font.h"
+#include "mock_display.h"
+
+#define CASES 5000
+
+static ssd1306_t ssd;
+static mock_display_t display;
+static uint8_t before[SSD1306_BUFFER_SIZE(WIDTH, HEIGHT)];
+static uint8_t expected[SSD1306_BUFFER_SIZE(WIDTH, HEIGHT)];
+static unsigned failures;
+
+static void check(bool ok, const char *name)
+{
+  printf("%-52s %s\n", name, ok ? "ok" : "FALHOU");
+  if (!ok)
+    failures++;
+}
+
+static bool printable(unsigned code)
+{
+  return (code >= 0x20 && code < 0x7F) || code >= 0xA0;
+}
+
+static size_t put_utf8(char *out, unsigned code)
+{
+  if (code < 0x80)
+  {
+    out[0] = (char)code;
+    return 1;
+  }
+  out[0] = (char)(0xC0 | (code >> 6));
+  out[1] = (char)(0x80 | (code & 0x3F));
+  return 2;
+}
+
+static void ref_pixel(int x, int y, bool value)
+{
+  if (x < 0 || y < 0 || x >= WIDTH || y >= HEIGHT)
+    return;
+  uint8_t *byte = &expected[ssd1306_index(&ssd, x, y >> 3)];
+  if (value)
+    *byte |= 1 << (y & 0b111);
+  else
+    *byte &= ~(1 << (y & 0b111));
+}
+
+// Glyph a glyph: as colunas de left a left + width - 1, uma coluna apagada
+// entre glyphs se couber, e a próxima linha quando o glyph não cabe
+static void ref_string(const unsigned *codes, size_t count, int x, int y)
+{
+  for (size_t n = 0; n < count && y + FONT_LINE_HEIGHT <= HEIGHT; ++n)
+  {
+    const font_glyph_t *glyph = font_glyph(codes[n]);
+    if (x + glyph->width > WIDTH)
+    {
+      x = 0;
+      y += FONT_LINE_HEIGHT;
+      if (y + FONT_LINE_HEIGHT > HEIGHT)
+        break;
+    }
+    for (int i = 0; i < glyph->width; ++i, ++x)
+      for (int row = 0; row < 8; ++row)
+        ref_pixel(x, y + row, glyph->columns[glyph->left + i] & (1 << row));
+    if (x + FONT_SPACING <= WIDTH)
+    {
+      for (int row = 0; row < 8; ++row)
+        ref_pixel(x, y + row, false);
+      x += FONT_SPACING;
+    }
+  }
+}
+
+// Quadro aleatório já enviado, com a região alterada vazia
+static void start_case(void)
+{
+  for (size_t i = 1; i < ssd.bufsize; ++i)
+    ssd.ram_buffer[i] = rand();
+  ssd1306_send_data(&ssd);
+  memcpy(before, ssd.ram_buffer, ssd.bufsize);
+  memcpy(expected, ssd.ram_buffer, ssd.bufsize);
+}
+
+static bool finish_case(void)
+{
+  if (memcmp(ssd.ram_buffer, expected, ssd.bufsize) != 0)
+    return false;
+  for (uint8_t x = 0; x < ssd.width; ++x)
+  {
+    for (uint8_t page = 0; page < ssd.pages; ++page)
+    {
+      uint16_t i = ssd1306_index(&ssd, x, page);
+      bool inside = x >= ssd.dirty_x0 && x <= ssd.dirty_x1 && page >= ssd.dirty_page0 && page <= ssd.dirty_page1;
+      if (before[i] != ssd.ram_buffer[i] && !inside)
+        return false;
+    }
+  }
+  ssd1306_send_dirty(&ssd);
+  return mock_display_matches(&display, &ssd);
+}
+
+// O texto desenhado e a largura são os mesmos de um único '?'
+static bool shows_question_mark(const char *text)
+{
+  start_case();
+  ssd1306_draw_string(&ssd, text, 10, 20);
+  unsigned question = '?';
+  ref_string(&question, 1, 10, 20);
+  return ssd1306_string_width(text) == font_glyph('?')->width && finish_case();
+}
+
+int main(void)
+{
+  ssd1306_init(&ssd, WIDTH, HEIGHT, false, 0x3C, NULL);
+  mock_display_attach(&ssd, &display);
+  srand(1);
+
+  // Todo caractere imprimível tem desenho (menos os espaços), os controles
+  // usam o espaço, e left/width cobrem exatamente as colunas acesas
+  const font_glyph_t *space = font_glyph(' ');
+  bool covered = true, consistent = true;
+  for (unsigned code = 0; code < FONT_CODES; ++code)
+  {
+    const font_glyph_t *glyph = font_glyph(code);
+    bool blank = code == 0x20 || code == 0xA0;
+    if (printable(code) && !blank)
+    {
+      uint8_t lit = 0;
+      for (uint8_t i = 0; i < FONT_GLYPH_COLUMNS; ++i)
+        lit |= glyph->columns[i];
+      covered &= lit != 0;
+      consistent &= glyph->width > 0 && glyph->left + glyph->width <= FONT_GLYPH_COLUMNS;
+      consistent &= glyph->columns[glyph->left] && glyph->columns[glyph->left + glyph->width - 1];
+      for (uint8_t i = 0; i < FONT_GLYPH_COLUMNS; ++i)
+        consistent &= (i >= glyph->left && i < glyph->left + glyph->width) || glyph->columns[i] == 0;
+    }
+    else
+    {
+      covered &= printable(code) ? glyph->width > 0 : glyph == space;
+    }
+  }
+  check(covered, "ASCII e Latin-1 com glyph, controles no espaço");
+  check(consistent, "left/width cobrem as colunas acesas");
+  check(font_glyph(0xAD) == font_glyph('-') && font_glyph(0xA0) == space, "códigos que reaproveitam outro glyph");
+
+  // draw_char ocupa a célula inteira de 8x8, como antes
+  start_case();
+  ssd1306_draw_char(&ssd, (char)0xE7, 40, 13);
+  for (int i = 0; i < 8; ++i)
+    for (int row = 0; row < 8; ++row)
+      ref_pixel(40 + i, 13 + row, font_glyph(0xE7)->columns[i] & (1 << row));
+  check(finish_case(), "draw_char: célula de 8x8");
+
+  // UTF-8: 2 bytes viram o código Latin-1; o resto aparece como '?'
+  start_case();
+  ssd1306_draw_string(&ssd, "çãé", 0, 0);
+  unsigned accents[] = {0xE7, 0xE3, 0xE9};
+  ref_string(accents, 3, 0, 0);
+  check(finish_case() && ssd1306_string_width("çãé") == font_glyph(0xE7)->width + font_glyph(0xE3)->width +
+                                                            font_glyph(0xE9)->width + 2 * FONT_SPACING,
+        "UTF-8 de 2 bytes");
+  check(shows_question_mark("\xE2\x82\xAC"), "U+20AC (3 bytes) vira '?'");
+  check(shows_question_mark("\xF0\x9F\x98\x80"), "U+1F600 (4 bytes) vira '?'");
+  check(shows_question_mark("\xC1\x81"), "sequência longa demais vira '?'");
+  check(shows_question_mark("\x80"), "continuação solta vira '?'");
+  check(shows_question_mark("\xC3"), "sequência cortada no fim vira '?'");
+  check(ssd1306_string_width("\xE9t") == font_glyph('?')->width + FONT_SPACING + font_glyph('t')->width,
+        "byte Latin-1 cru não engole o próximo");
+  check(ssd1306_string_width("") == 0, "texto vazio tem largura 0");
+
+  // Texto proporcional cabe mais numa linha que as células de 8 pixels
+  const char *sentence = "Posição do joystick: X 2048, Y 95";
+  check(ssd1306_string_width(sentence) < 8 * 33 && ssd1306_string_width("iiii") < 4 * 8,
+        "texto proporcional mais estreito que 8 por caractere");
+
+  // Textos aleatórios em qualquer posição, com quebra de linha
+  bool all_match = true;
+  for (unsigned n = 0; n < CASES && all_match; ++n)
+  {
+    unsigned codes[80];
+    char text[2 * 80 + 1];
+    size_t count = 1 + rand() % 80, length = 0;
+    uint16_t width = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+      do
+        codes[i] = rand() % FONT_CODES;
+      while (!printable(codes[i]));
+      length += put_utf8(&text[length], codes[i]);
+      width += font_glyph(codes[i])->width + FONT_SPACING;
+    }
+    text[length] = '\0';
+    int x = rand() % WIDTH, y = rand() % HEIGHT;
+
+    start_case();
+    ssd1306_draw_string(&ssd, text, x, y);
+    ref_string(codes, count, x, y);
+    all_match &= finish_case() && ssd1306_string_width(text) == width - FONT_SPACING;
+    if (!all_match)
+      printf("  texto #%u em (%d, %d) difere do modelo\n", n, x, y);
+  }
+  check(all_match, "draw_string igual ao modelo, com quebra de linha");
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,147 @@
+// Testes da fila SPSC e do pipeline de quadros (bibliotecas/frame_queue.c)
+// com o produtor e o consumidor em std::thread, como core0 e core1 na placa:
+// a fila entrega tudo na ordem, e o pipeline nunca entrega um quadro mais
+// velho que o anterior, não deixa o produtor reescrever um quadro em envio e
+// conta exatamente os quadros descartados.
+#include <stdio.h>
+#include <thread>
+#include "bibliotecas/frame_queue.h"
+
+static unsigned failures;
+
+static void check(bool ok, const char *name)
+{
+  printf("%-52s %s\n", name, ok ? "ok" : "FALHOU");
+  if (!ok)
+    failures++;
+}
+
+// Sem threads: três quadros prontos antes do consumidor acordar
+static void test_take_latest(void)
+{
+  static frame_pipeline_t pipeline;
+  frame_pipeline_init(&pipeline, 3);
+
+  uint8_t frames[3];
+  bool acquired = true;
+  for (uint8_t i = 0; i < 3; ++i)
+  {
+    acquired &= frame_pipeline_acquire(&pipeline, &frames[i]);
+    frame_pipeline_submit(&pipeline, frames[i]);
+  }
+  uint8_t spare;
+  check(acquired && !frame_pipeline_acquire(&pipeline, &spare), "acquire falha com todos os quadros em uso");
+
+  uint8_t latest;
+  bool taken = frame_pipeline_take_latest(&pipeline, &latest);
+  check(taken && latest == frames[2] && pipeline.dropped == 2, "take_latest entrega o mais novo e descarta 2");
+
+  // Os descartados voltam à fila de livres na ordem em que foram desenhados
+  uint8_t a, b;
+  bool freed = frame_pipeline_acquire(&pipeline, &a) && frame_pipeline_acquire(&pipeline, &b);
+  check(freed && a == frames[0] && b == frames[1] && !frame_pipeline_acquire(&pipeline, &spare),
+        "descartados voltam livres, o entregue não");
+
+  frame_pipeline_release(&pipeline, latest);
+  check(frame_pipeline_acquire(&pipeline, &spare) && spare == latest, "release devolve o quadro enviado");
+  check(!frame_pipeline_take_latest(&pipeline, &spare), "take_latest com a fila vazia");
+}
+
+// Fila entre duas threads: o produtor insiste quando está cheia, então o
+// consumidor tem que ver a sequência inteira, sem perdas nem troca de ordem
+static void test_queue_order(void)
+{
+  static frame_queue_t queue;
+  frame_queue_init(&queue);
+  const unsigned count = 2000000;
+
+  std::thread producer([&] {
+    for (unsigned i = 0; i < count; ++i)
+    {
+      while (!frame_queue_push(&queue, (uint8_t)i))
+        std::this_thread::yield();
+    }
+  });
+
+  unsigned received = 0, out_of_order = 0;
+  while (received < count)
+  {
+    uint8_t value;
+    if (!frame_queue_pop(&queue, &value))
+    {
+      std::this_thread::yield();
+      continue;
+    }
+    if (value != (uint8_t)received)
+      out_of_order++;
+    received++;
+  }
+  producer.join();
+
+  uint8_t extra;
+  check(out_of_order == 0 && !frame_queue_pop(&queue, &extra), "fila SPSC: 2M itens na ordem, sem perdas");
+}
+
+// Pipeline entre duas threads: cada quadro leva o número de sequência em que
+// foi desenhado. O consumidor confere que a sequência só cresce e que o
+// conteúdo não muda enquanto o quadro está com ele.
+static void test_pipeline_threads(void)
+{
+  static frame_pipeline_t pipeline;
+  static unsigned content[FRAME_PIPELINE_MAX_FRAMES];
+  static std::atomic<bool> done;
+  const uint8_t frames = 3;
+  const unsigned count = 500000;
+  frame_pipeline_init(&pipeline, frames);
+  done = false;
+
+  unsigned submitted = 0;
+  std::thread producer([&] {
+    for (unsigned seq = 1; seq <= count; ++seq)
+    {
+      uint8_t frame;
+      while (!frame_pipeline_acquire(&pipeline, &frame))
+        std::this_thread::yield();
+      content[frame] = seq; // "Desenha" o quadro
+      frame_pipeline_submit(&pipeline, frame);
+      submitted++;
+    }
+    done = true;
+  });
+
+  unsigned delivered = 0, last = 0, backwards = 0, overwritten = 0;
+  while (true)
+  {
+    bool finished = done;
+    uint8_t frame;
+    if (frame_pipeline_take_latest(&pipeline, &frame))
+    {
+      unsigned seq = content[frame];
+      if (seq <= last)
+        backwards++;
+      last = seq;
+      std::this_thread::yield(); // "Envia" o quadro
+      if (content[frame] != seq)
+        overwritten++;
+      frame_pipeline_release(&pipeline, frame);
+      delivered++;
+    }
+    else if (finished)
+      break;
+  }
+  producer.join();
+
+  check(backwards == 0, "pipeline: nenhum quadro mais velho que o anterior");
+  check(overwritten == 0, "pipeline: quadro em envio não é reescrito");
+  check(last == count, "pipeline: o último quadro desenhado é entregue");
+  check(delivered + pipeline.dropped == submitted, "pipeline: entregues + descartados = desenhados");
+  printf("  %u desenhados, %u entregues, %u descartados\n", submitted, delivered, (unsigned)pipeline.dropped);
+}
+
+int main()
+{
+  test_take_latest();
+  test_queue_order();
+  test_pipeline_threads();
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,149 @@
+// Teste de regressão do framebuffer: desenha os seis estilos de borda, todos
+// os glyphs da fonte, um texto e um quadro com sprite, envia cada cena pelo
+// transporte simulado e compara a GDDRAM recebida com as referências em
+// host/golden/. Termina com erro se algum byte for diferente.
+//
+//   ./build-host/host/test_golden host/golden
+//   ./build-host/host/test_golden host/golden --atualizar   (regrava as referências)
+//
+// Só regravar depois de conferir que a mudança no desenho é intencional.
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "bibliotecas/ssd1306.h"
+#include "mock_display.h"
+
+#define GOLDEN_SIZE (WIDTH * HEIGHT / 8)
+
+static ssd1306_t ssd;
+static mock_display_t display;
+static const char *golden_dir;
+static bool update;
+static unsigned failures;
+
+// Confere a GDDRAM simulada com host/golden/<nome>.bin (ou a grava)
+static void check_scene(const char *name)
+{
+  char path[256];
+  snprintf(path, sizeof(path), "%s/%s.bin", golden_dir, name);
+
+  if (!mock_display_matches(&display, &ssd))
+  {
+    printf("%-20s GDDRAM simulada difere do ram_buffer\n", name);
+    failures++;
+    return;
+  }
+
+  if (update)
+  {
+    FILE *file = fopen(path, "wb");
+    if (!file || fwrite(display.ram, 1, GOLDEN_SIZE, file) != GOLDEN_SIZE)
+    {
+      printf("%-20s não foi possível gravar %s\n", name, path);
+      failures++;
+    }
+    if (file)
+      fclose(file);
+    return;
+  }
+
+  uint8_t expected[GOLDEN_SIZE];
+  FILE *file = fopen(path, "rb");
+  size_t read = file ? fread(expected, 1, sizeof(expected), file) : 0;
+  if (file)
+    fclose(file);
+  if (read != sizeof(expected))
+  {
+    printf("%-20s referência %s ausente ou incompleta\n", name, path);
+    failures++;
+    return;
+  }
+
+  for (uint16_t i = 0; i < GOLDEN_SIZE; ++i)
+  {
+    if (display.ram[i] != expected[i])
+    {
+      printf("%-20s difere da referência: coluna %u, página %u (0x%02x, esperado 0x%02x)\n", name, i / 8, i % 8,
+             display.ram[i], expected[i]);
+      failures++;
+      return;
+    }
+  }
+  printf("%-20s ok\n", name);
+}
+
+// Quadro limpo, enviado inteiro para que a cena seguinte parta do zero
+static void clear_scene(void)
+{
+  ssd1306_fill(&ssd, false);
+  ssd1306_send_data(&ssd);
+}
+
+// 128 caracteres por tela em células de 8x8
+static void draw_glyph_grid(uint16_t first)
+{
+  for (uint16_t i = 0; i < 128; ++i)
+    ssd1306_draw_char(&ssd, (char)(first + i), (i % 16) * 8, (i / 16) * 8);
+}
+
+int main(int argc, char **argv)
+{
+  if (argc < 2)
+  {
+    printf("uso: %s DIRETORIO_GOLDEN [--atualizar]\n", argv[0]);
+    return 2;
+  }
+  golden_dir = argv[1];
+  update = argc > 2 && strcmp(argv[2], "--atualizar") == 0;
+
+  ssd1306_init(&ssd, WIDTH, HEIGHT, false, 0x3C, NULL);
+  mock_display_attach(&ssd, &display);
+  ssd1306_config(&ssd);
+
+  for (uint8_t style = 0; style < 6; ++style)
+  {
+    char name[16];
+    snprintf(name, sizeof(name), "borda_%u", style);
+    clear_scene();
+    draw_border(&ssd, style);
+    ssd1306_send_data(&ssd);
+    check_scene(name);
+  }
+
+  clear_scene();
+  draw_glyph_grid(0x00);
+  ssd1306_send_dirty(&ssd);
+  check_scene("glyphs_ascii");
+
+  clear_scene();
+  draw_glyph_grid(0x80);
+  ssd1306_send_dirty(&ssd);
+  check_scene("glyphs_latin1");
+
+  clear_scene();
+  ssd1306_draw_string(&ssd, "Posição X 2048, Y 95", 3, 5);
+  ssd1306_draw_string(&ssd, "ÁÉÍÓÚ àç ñü ¿? [50%] {ok} ~_|", 0, 21);
+  ssd1306_draw_string(&ssd, "texto longo que quebra a linha no fim da tela", 9, 40);
+  ssd1306_send_dirty(&ssd);
+  check_scene("texto");
+
+  // Quadro do laço principal: borda, quadrado como sprite movido algumas
+  // vezes (o fundo volta do buffer salvo) e só a região alterada enviada
+  static ssd1306_sprite_t sprite;
+  static uint8_t background[SSD1306_SPRITE_BACKGROUND_SIZE(SQUARE_SIZE, SQUARE_SIZE)];
+  clear_scene();
+  draw_border_copy(&ssd, 1);
+  ssd1306_send_dirty(&ssd);
+  ssd1306_sprite_init(&sprite, SQUARE_SIZE, SQUARE_SIZE, NULL, SSD1306_SPRITE_BACKGROUND, background);
+  const int16_t path[][2] = {{60, 28}, {61, 27}, {0, 0}, {WIDTH - SQUARE_SIZE, 13}, {37, HEIGHT - SQUARE_SIZE}};
+  for (size_t i = 0; i < sizeof(path) / sizeof(path[0]); ++i)
+  {
+    ssd1306_sprite_move(&ssd, &sprite, path[i][0], path[i][1]);
+    ssd1306_send_dirty(&ssd);
+  }
+  check_scene("sprite");
+
+  if (failures)
+    printf("\n%u cenas com erro\n", failures);
+  return failures ? 1 : 0;
+}
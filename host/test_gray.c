@@ -0,0 +1,120 @@
+// Testes dos tons de cinza (bibliotecas/ssd1306_gray.c) no laço do main.c:
+// ssd1306_gray_run_until até o prazo do frame_scheduler, com o transporte
+// simulado e o relógio simulado (1 us por leitura). Nenhum quadro pode contar
+// como perdido, o plano 1 tem que ficar ~2/3 do tempo na GDDRAM e, no fim de
+// cada fatia, a GDDRAM é o plano dela, mesmo com um quadro apresentado no
+// meio da fatia.
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "bibliotecas/ssd1306.h"
+#include "bibliotecas/ssd1306_gray.h"
+#include "bibliotecas/frame_scheduler.h"
+#include "mock_display.h"
+
+#define FRAME_PERIOD_US 20000
+#define FRAMES 25
+
+static ssd1306_t ssd;
+static mock_display_t display;
+static ssd1306_transport_t timed_transport;
+static ssd1306_gray_t gray;
+static uint8_t gray_planes[2][WIDTH * HEIGHT / 8 + 1];
+static unsigned failures;
+
+// Tempo de cada plano na GDDRAM: conta do primeiro byte de um plano até o
+// primeiro byte do outro. O plano de cada fatia segue a ordem 1, 0, 1.
+static int shown_plane = -1;
+static absolute_time_t shown_since;
+static uint64_t plane_us[2];
+
+static void check(bool ok, const char *name)
+{
+  printf("%-44s %s\n", name, ok ? "ok" : "FALHOU");
+  if (!ok)
+    failures++;
+}
+
+static void timed_write_data(ssd1306_t *ssd, uint8_t *data, size_t count)
+{
+  int plane = gray.slice == 1 ? 0 : 1;
+  if (plane != shown_plane)
+  {
+    absolute_time_t now = get_absolute_time();
+    if (shown_plane >= 0)
+      plane_us[shown_plane] += absolute_time_diff_us(shown_since, now);
+    shown_plane = plane;
+    shown_since = now;
+  }
+  mock_display_transport.write_data(ssd, data, count);
+}
+
+// Degradê de quatro faixas: todo byte de nível 1 ou 2 muda a cada fatia
+static void gray_gradient(void)
+{
+  ssd1306_gray_fill(&gray, 0);
+  for (uint8_t level = 0; level < SSD1306_GRAY_LEVELS; ++level)
+    ssd1306_gray_rect(&gray, 0, level * WIDTH / 4, WIDTH / 4, HEIGHT, level, true);
+}
+
+int main(void)
+{
+  mock_clock_step_us = 1;
+  ssd1306_init(&ssd, WIDTH, HEIGHT, false, 0x3C, NULL);
+  mock_display_attach(&ssd, &display);
+  timed_transport = mock_display_transport;
+  timed_transport.write_data = timed_write_data;
+  ssd.transport = &timed_transport;
+  ssd1306_gray_init(&gray, &ssd, gray_planes[0], gray_planes[1]);
+
+  frame_scheduler_t scheduler;
+  frame_scheduler_init(&scheduler, FRAME_PERIOD_US);
+  bool slices_whole = true;
+  for (unsigned frame = 0; frame < FRAMES; ++frame)
+  {
+    if (frame % 5 == 0)
+    {
+      if (frame % 10 == 0)
+        gray_gradient();
+      else
+        ssd1306_gray_border(&gray, 3);
+      ssd1306_gray_present(&gray);
+    }
+    uint32_t before = gray.planes_shown;
+    ssd1306_gray_run_until(&gray, scheduler.deadline);
+    slices_whole &= (gray.planes_shown - before) % SSD1306_GRAY_SLICES == 0 && gray.slice == 0;
+    frame_scheduler_wait(&scheduler);
+  }
+
+  printf("  %lu fatias em %u quadros, plano 1 %.1f ms, plano 0 %.1f ms\n", (unsigned long)gray.planes_shown, FRAMES,
+         plane_us[1] / 1000.0, plane_us[0] / 1000.0);
+  check(scheduler.missed == 0, "nenhum quadro perdido pelo frame_scheduler");
+  check(slices_whole, "ciclos inteiros de fatias por quadro");
+  double ratio = plane_us[0] ? (double)plane_us[1] / plane_us[0] : 0;
+  check(ratio > 1.6 && ratio < 2.4, "plano 1 fica o dobro do tempo do plano 0");
+
+  // Depois de uma fatia inteira a GDDRAM é o plano mostrado nela
+  while (ssd1306_gray_poll(&gray))
+    ;
+  check(mock_display_matches(&display, &gray.plane[1]), "GDDRAM igual ao plano da fatia");
+
+  // Quadro apresentado no meio de uma fatia: a lista de trechos muda e a
+  // fatia tem que reenviar todos os trechos novos, não seguir do índice antigo
+  ssd.transport = &mock_display_transport;
+  ssd1306_gray_init(&gray, &ssd, gray_planes[0], gray_planes[1]);
+  for (uint8_t page = 0; page < 6; ++page)
+    ssd1306_gray_rect(&gray, page * 8, 10, 8, 8, 1, true); // Um trecho por página
+  ssd1306_gray_present(&gray);
+  while (ssd1306_gray_poll(&gray))
+    ;
+  ssd1306_gray_next_slice(&gray); // Fatia 1: plano 0
+  for (int n = 0; n < 3; ++n)
+    ssd1306_gray_poll(&gray);
+  ssd1306_gray_rect(&gray, 0, 10, 8, 8, 3, true); // O primeiro trecho deixa de ser cinza
+  ssd1306_gray_present(&gray);
+  while (ssd1306_gray_poll(&gray))
+    ;
+  check(gray.span_count == 5 && mock_display_matches(&display, &gray.plane[0]),
+        "quadro novo no meio da fatia: todos os trechos");
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,103 @@
+// Testes do HUD (bibliotecas/hud.c) no esquema do main.c com SHOW_HUD:
+// campos nas linhas de cima e de baixo e o quadrado como sprite no meio.
+// As células do HUD não entram na região alterada do display; cada campo
+// envia só as suas, e a GDDRAM simulada termina igual ao ram_buffer.
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "bibliotecas/ssd1306.h"
+#include "bibliotecas/hud.h"
+#include "mock_display.h"
+
+#define HUD_TOP_Y 8
+#define HUD_MARGIN 16
+
+static ssd1306_t ssd;
+static mock_display_t display;
+static hud_field_t adc_x, fps;
+static ssd1306_sprite_t square;
+static uint8_t square_background[SSD1306_SPRITE_BACKGROUND_SIZE(SQUARE_SIZE, SQUARE_SIZE)];
+static unsigned failures;
+
+static void check(bool ok, const char *name)
+{
+  printf("%-48s %s\n", name, ok ? "ok" : "FALHOU");
+  if (!ok)
+    failures++;
+}
+
+// Um quadro do laço: HUD, quadrado, envio dos campos e da região alterada.
+// Retorna os bytes de dados que chegaram ao display.
+static size_t frame(uint16_t x_value, uint16_t fps_value, int16_t square_x, int16_t square_y)
+{
+  size_t before = display.data_bytes;
+  hud_field_printf(&ssd, &adc_x, "X%4u", x_value);
+  hud_field_printf(&ssd, &fps, "%2uFPS", fps_value);
+  ssd1306_sprite_move(&ssd, &square, square_x, square_y);
+  hud_field_flush(&ssd, &adc_x);
+  hud_field_flush(&ssd, &fps);
+  ssd1306_send_dirty(&ssd);
+  return display.data_bytes - before;
+}
+
+int main(void)
+{
+  ssd1306_init(&ssd, WIDTH, HEIGHT, false, 0x3C, NULL);
+  mock_display_attach(&ssd, &display);
+  draw_border_copy(&ssd, 1);
+  ssd1306_send_data(&ssd);
+  hud_field_init(&adc_x, 8, HUD_TOP_Y, 5);
+  hud_field_init(&fps, 8, HEIGHT - HUD_MARGIN, 5);
+  ssd1306_sprite_init(&square, SQUARE_SIZE, SQUARE_SIZE, NULL, SSD1306_SPRITE_BACKGROUND, square_background);
+
+  frame(2048, 50, 60, 28);
+  check(mock_display_matches(&display, &ssd), "primeiro quadro: GDDRAM igual ao ram_buffer");
+
+  // Um dígito do X muda e o quadrado anda um pixel: o campo manda uma célula
+  // (8 colunas, 1 página) e a região alterada fica só em volta do quadrado
+  hud_field_printf(&ssd, &adc_x, "X%4u", 2049);
+  check(ssd.dirty_x0 > ssd.dirty_x1, "hud_field_set não mexe na região alterada");
+  check(adc_x.damage_x0 == 8 + 4 * 8 && adc_x.damage_x1 == 8 + 4 * 8 + 7, "região do campo: a célula do dígito");
+  check(!ssd1306_blit_char(&ssd, '9', 8 + 4 * 8, HUD_TOP_Y) && ssd.dirty_x0 > ssd.dirty_x1,
+        "ssd1306_blit_char: mesmo glyph não muda nada");
+
+  ssd1306_sprite_move(&ssd, &square, 61, 28);
+  uint8_t dirty_page0 = ssd.dirty_page0, dirty_page1 = ssd.dirty_page1;
+  uint8_t dirty_columns = ssd.dirty_x1 - ssd.dirty_x0 + 1;
+  check(dirty_page0 >= HUD_MARGIN / 8 && dirty_page1 < (HEIGHT - HUD_MARGIN) / 8,
+        "região alterada fora das linhas do HUD");
+
+  size_t before = display.data_bytes;
+  hud_field_flush(&ssd, &adc_x);
+  hud_field_flush(&ssd, &fps);
+  size_t hud_bytes = display.data_bytes - before;
+  ssd1306_send_dirty(&ssd);
+  size_t total = display.data_bytes - before;
+  printf("  HUD %zu bytes, quadro %zu bytes (tela inteira: %u)\n", hud_bytes, total, WIDTH * HEIGHT / 8);
+  check(hud_bytes == 8, "HUD envia só a célula alterada");
+  check(total == hud_bytes + dirty_columns * (dirty_page1 - dirty_page0 + 1), "quadro = célula + caixa do quadrado");
+  check(mock_display_matches(&display, &ssd), "GDDRAM igual ao ram_buffer");
+
+  // Sem mudança no texto, nada do HUD vai para o barramento
+  before = display.data_bytes;
+  hud_field_flush(&ssd, &adc_x);
+  check(frame(2049, 50, 61, 28) == 0 && display.data_bytes == before, "texto igual: nenhum byte");
+
+  // Vários quadros com os dois campos mudando: o display continua em dia
+  bool synced = true;
+  for (uint16_t n = 0; n < 200; ++n)
+  {
+    frame(n * 37 % 4096, n % 60, 20 + n % 80, HUD_MARGIN + n % (HEIGHT - 2 * HUD_MARGIN - SQUARE_SIZE));
+    synced &= mock_display_matches(&display, &ssd);
+  }
+  check(synced, "200 quadros: GDDRAM igual ao ram_buffer");
+
+  // Campo invalidado (troca de borda) redesenha e envia todas as células
+  draw_border_copy(&ssd, 2);
+  ssd1306_sprite_invalidate(&square);
+  hud_field_invalidate(&adc_x);
+  hud_field_invalidate(&fps);
+  frame(123, 7, 40, 30);
+  check(mock_display_matches(&display, &ssd), "troca de borda: GDDRAM igual ao ram_buffer");
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,132 @@
+// Testes do debounce de input_events com fluxos de bordas gravados de um
+// botão com pull-up: o repique de um toque vira um evento só, um toque mais
+// curto que a janela solta no fim dela e um duplo clique lido de uma vez só
+// (laço atrasado) entrega os quatro eventos na ordem, com os mesmos
+// instantes que teria se fosse lido borda a borda.
+#include <stdio.h>
+#include "bibliotecas/input_events.h"
+
+#define DEBOUNCE_US 20000
+#define BUTTON 5
+#define OTHER 6
+
+typedef struct
+{
+  uint32_t timestamp_us;
+  bool pressed;
+} recorded_edge_t;
+
+// Toque com repique nas duas bordas (intervalos de um botão real, em us)
+static const recorded_edge_t bounce[] = {
+    {100000, true},  {100180, false}, {100410, true},  {100590, false}, {101020, true},
+    {250000, false}, {250150, true},  {250300, false}, {250720, true},  {251100, false},
+};
+
+// Duplo clique: os dois soltares caem dentro da janela do toque anterior
+static const recorded_edge_t double_click[] = {
+    {500000, true}, {500200, false}, {500350, true}, {512000, false},
+    {560000, true}, {560090, false}, {560260, true}, {571000, false},
+};
+
+static input_events_t input;
+static input_event_t events[16];
+static unsigned failures;
+
+static void check(bool ok, const char *name)
+{
+  printf("%-52s %s\n", name, ok ? "ok" : "FALHOU");
+  if (!ok)
+    failures++;
+}
+
+static void start(void)
+{
+  input_events_init(&input, DEBOUNCE_US);
+  input_events_add_pin(&input, BUTTON, false);
+  input_events_add_pin(&input, OTHER, false);
+}
+
+static void push(const recorded_edge_t *edges, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+    input_events_push_edge(&input, BUTTON, !edges[i].pressed, edges[i].timestamp_us);
+}
+
+// Lê tudo numa chamada por vez com no máximo `max_events` por chamada
+static size_t poll_all(uint32_t now_us, size_t max_events)
+{
+  size_t total = 0, n;
+  while ((n = input_events_poll(&input, now_us, &events[total], max_events)) > 0)
+    total += n;
+  return total;
+}
+
+static bool expect(size_t count, size_t n, const uint32_t *timestamps)
+{
+  if (count != n)
+    return false;
+  for (size_t i = 0; i < n; ++i)
+  {
+    if (events[i].gpio != BUTTON || events[i].pressed != (i % 2 == 0) || events[i].timestamp_us != timestamps[i])
+      return false;
+  }
+  return true;
+}
+
+int main(void)
+{
+  // Repique: um evento na primeira borda de cada lado
+  start();
+  push(bounce, sizeof(bounce) / sizeof(bounce[0]));
+  const uint32_t bounce_events[] = {100000, 250000};
+  check(expect(poll_all(400000, 16), 2, bounce_events), "repique: pressionar e soltar, um evento cada");
+
+  // Toque curto: o soltar sai no fim da janela, não antes
+  start();
+  input_events_push_edge(&input, BUTTON, false, 1000000);
+  input_events_push_edge(&input, BUTTON, true, 1008000);
+  size_t count = input_events_poll(&input, 1010000, events, 16);
+  bool ok = count == 1 && events[0].pressed;
+  count = input_events_poll(&input, 1019999, events, 16);
+  ok &= count == 0;
+  count = input_events_poll(&input, 1030000, events, 16);
+  check(ok && count == 1 && !events[0].pressed && events[0].timestamp_us == 1000000 + DEBOUNCE_US,
+        "toque curto: soltar no fim da janela");
+
+  // Duplo clique lido de uma vez, bem depois: os soltares pendentes saem antes
+  // das bordas seguintes, com o instante do fim de cada janela
+  const uint32_t click_events[] = {500000, 520000, 560000, 580000};
+  start();
+  push(double_click, sizeof(double_click) / sizeof(double_click[0]));
+  check(expect(poll_all(900000, 16), 4, click_events), "duplo clique lido de uma vez");
+
+  // O mesmo fluxo com um evento por chamada
+  start();
+  push(double_click, sizeof(double_click) / sizeof(double_click[0]));
+  check(expect(poll_all(900000, 1), 4, click_events), "duplo clique, um evento por chamada");
+
+  // O mesmo fluxo lido borda a borda, como num laço sem atraso
+  start();
+  count = 0;
+  for (size_t i = 0; i < sizeof(double_click) / sizeof(double_click[0]); ++i)
+  {
+    push(&double_click[i], 1);
+    count += input_events_poll(&input, double_click[i].timestamp_us, &events[count], 16 - count);
+  }
+  count += input_events_poll(&input, 900000, &events[count], 16 - count);
+  check(expect(count, 4, click_events), "duplo clique lido borda a borda");
+
+  // Outro pino não interfere e seus eventos saem em ordem de tempo com os do
+  // botão; pino desconhecido é ignorado
+  start();
+  push(double_click, 2);
+  input_events_push_edge(&input, 9, false, 500100);
+  input_events_push_edge(&input, OTHER, false, 530000);
+  count = poll_all(900000, 16);
+  check(count == 3 && events[0].gpio == BUTTON && events[0].pressed && events[1].gpio == BUTTON &&
+            !events[1].pressed && events[1].timestamp_us == 520000 && events[2].gpio == OTHER && events[2].pressed &&
+            events[2].timestamp_us == 530000,
+        "outros pinos: independentes e em ordem de tempo");
+
+  return failures ? 1 : 0;
+}
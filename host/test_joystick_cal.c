@@ -0,0 +1,149 @@
+// Testes da calibração do joystick (bibliotecas/joystick_cal.c): tabelas com
+// a calibração padrão, aprendizado do centro de um joystick deslocado e com
+// ruído, do curso até os batentes, e o registro gravado na flash.
+#include <stdio.h>
+#include <stdlib.h>
+#include "bibliotecas/joystick_cal.h"
+
+#define SPAN_X 120 // WIDTH - SQUARE_SIZE
+#define SPAN_Y 56  // HEIGHT - SQUARE_SIZE
+#define FRAME_US 20000
+
+static joystick_cal_t cal;
+static unsigned failures;
+
+static void check(bool ok, const char *name)
+{
+  printf("%-52s %s\n", name, ok ? "ok" : "FALHOU");
+  if (!ok)
+    failures++;
+}
+
+// Posição na tela cresce com a leitura (X) ou diminui (Y), das bordas 0 a
+// span, e o brilho cresce ao se afastar do centro
+static bool tables_monotonic(uint8_t axis)
+{
+  uint8_t span = cal.span[axis];
+  uint16_t center = cal.axis[axis].center;
+  for (uint16_t adc = 4; adc < 4096; adc += 4)
+  {
+    int step = joystick_cal_screen(&cal, axis, adc) - joystick_cal_screen(&cal, axis, adc - 4);
+    if (axis == 1)
+      step = -step;
+    if (step < 0)
+      return false;
+
+    uint16_t now = joystick_cal_brightness(&cal, axis, adc);
+    uint16_t before = joystick_cal_brightness(&cal, axis, adc - 4);
+    if ((adc > center + 4 && now < before) || (adc < center && now > before))
+      return false;
+  }
+  uint8_t low = joystick_cal_screen(&cal, axis, cal.axis[axis].min);
+  uint8_t high = joystick_cal_screen(&cal, axis, cal.axis[axis].max);
+  return axis == 0 ? (low == 0 && high == span) : (low == span && high == 0);
+}
+
+static int distance(int a, int b)
+{
+  return a > b ? a - b : b - a;
+}
+
+// Centro e zona morta: 1 s de leituras com o joystick parado em (x, y)
+static uint32_t feed_rest(uint16_t x, uint16_t y, uint32_t now, bool *finished)
+{
+  for (uint32_t t = 0; t <= JOYSTICK_CAL_CENTER_US + FRAME_US; t += FRAME_US, now += FRAME_US)
+  {
+    uint16_t nx = x + rand() % 41 - 20, ny = y + rand() % 41 - 20;
+    if (joystick_cal_feed(&cal, nx, ny, now))
+    {
+      *finished = true;
+      return now;
+    }
+  }
+  *finished = false;
+  return now;
+}
+
+int main(void)
+{
+  srand(1);
+  joystick_cal_init(&cal, SPAN_X, SPAN_Y);
+  check(tables_monotonic(0) && tables_monotonic(1), "padrão: tabelas monótonas, bordas em 0 e span");
+  check(joystick_cal_screen(&cal, 0, 2048) == SPAN_X / 2 && joystick_cal_screen(&cal, 1, 2048) == SPAN_Y / 2,
+        "padrão: 2048 no meio da tela");
+  // As tabelas têm uma entrada a cada 4 contagens: a borda da zona morta
+  // cai na entrada de 2144-2147
+  check(joystick_cal_brightness(&cal, 0, 2048 + 96) == 0 && joystick_cal_brightness(&cal, 0, 2048 + 104) > 0 &&
+            joystick_cal_brightness(&cal, 0, 4095) == 4095 && joystick_cal_brightness(&cal, 1, 0) == 4095,
+        "padrão: zona morta de 100 e brilho máximo nas pontas");
+
+  // Joystick que repousa fora do centro ideal: sem calibração o quadrado
+  // fica deslocado; depois dela, parado no meio e com os LEDs apagados
+  const uint16_t rest_x = 1890, rest_y = 2230;
+  check(joystick_cal_screen(&cal, 0, rest_x) < SPAN_X / 2 - 2, "sem calibração o repouso fica fora do meio");
+  joystick_cal_start(&cal, false, 0);
+  bool finished;
+  uint32_t now = feed_rest(rest_x, rest_y, 0, &finished);
+  check(finished && cal.phase == JOYSTICK_CAL_IDLE, "centro: termina depois de JOYSTICK_CAL_CENTER_US");
+  check(distance(cal.axis[0].center, rest_x) <= 4 && distance(cal.axis[1].center, rest_y) <= 4,
+        "centro: média das leituras paradas");
+  check(cal.axis[0].deadzone >= 40 && cal.axis[0].deadzone <= 84, "zona morta: o dobro do ruído visto");
+  bool still = true;
+  for (int noise = -20; noise <= 20; ++noise)
+  {
+    still &= distance(joystick_cal_screen(&cal, 0, rest_x + noise), SPAN_X / 2) <= 1;
+    still &= distance(joystick_cal_screen(&cal, 1, rest_y + noise), SPAN_Y / 2) <= 1;
+    still &= joystick_cal_brightness(&cal, 0, rest_x + noise) == 0;
+    still &= joystick_cal_brightness(&cal, 1, rest_y + noise) == 0;
+  }
+  check(still, "repouso com ruído: quadrado no meio, LEDs apagados");
+  check(tables_monotonic(0) && tables_monotonic(1), "calibrado: tabelas monótonas");
+
+  // Calibração completa: centro e depois o curso girando até os batentes
+  joystick_cal_start(&cal, true, now);
+  now = feed_rest(rest_x, rest_y, now, &finished);
+  check(!finished && cal.phase == JOYSTICK_CAL_RANGE, "completa: passa para a fase do curso");
+  const uint16_t stop_low = 310, stop_high = 3790;
+  for (uint32_t t = 0; !finished && t <= JOYSTICK_CAL_RANGE_US + FRAME_US; t += FRAME_US, now += FRAME_US)
+  {
+    // Onda triangular entre os batentes, 25 quadros por meia volta
+    uint32_t phase = t / FRAME_US % 50;
+    uint32_t travel = phase < 25 ? phase : 50 - phase;
+    uint16_t sweep = stop_low + travel * (stop_high - stop_low) / 25;
+    finished = joystick_cal_feed(&cal, sweep, stop_high + stop_low - sweep, now);
+  }
+  check(finished && cal.axis[0].min == stop_low && cal.axis[0].max == stop_high, "curso: mínimo e máximo vistos");
+  check(tables_monotonic(0) && tables_monotonic(1) && joystick_cal_brightness(&cal, 0, stop_high) == 4095,
+        "curso: batentes levam às bordas e ao brilho máximo");
+
+  // Registro da flash: volta igual, e registros corrompidos são recusados
+  joystick_cal_record_t record;
+  joystick_cal_export(&cal, &record);
+  static joystick_cal_t loaded;
+  joystick_cal_init(&loaded, SPAN_X, SPAN_Y);
+  bool imported = joystick_cal_import(&loaded, &record);
+  bool same = true;
+  for (uint8_t axis = 0; axis < JOYSTICK_CAL_AXES; ++axis)
+  {
+    for (uint16_t i = 0; i < JOYSTICK_CAL_LUT_SIZE; ++i)
+      same &= loaded.screen[axis][i] == cal.screen[axis][i] && loaded.brightness[axis][i] == cal.brightness[axis][i];
+  }
+  check(imported && same, "export/import refaz as mesmas tabelas");
+
+  joystick_cal_record_t bad = record;
+  bad.axis[0].center ^= 1;
+  check(!joystick_cal_import(&loaded, &bad), "checksum errado é recusado");
+  // Íntegro, mas com o mínimo no centro
+  static joystick_cal_t incoherent;
+  incoherent.axis[0] = record.axis[0];
+  incoherent.axis[1] = record.axis[1];
+  incoherent.axis[1].min = incoherent.axis[1].center;
+  joystick_cal_export(&incoherent, &bad);
+  check(!joystick_cal_import(&loaded, &bad), "mínimo no centro é recusado");
+  joystick_cal_record_t erased;
+  for (size_t i = 0; i < sizeof(erased); ++i)
+    ((uint8_t *)&erased)[i] = 0xFF;
+  check(!joystick_cal_import(&loaded, &erased), "flash apagada é ignorada");
+
+  return failures ? 1 : 0;
+}
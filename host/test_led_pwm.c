@@ -0,0 +1,100 @@
+// Testes do motor de LEDs (led_pwm) com o PWM simulado: a curva gama vai de
+// 0 a LED_PWM_WRAP sem descer e passa perto de x^2.2, cada transição chega ao
+// alvo no número de atualizações pedido sem passar dele, com o nível do PWM
+// sempre igual à gama do brilho atual, e a interrupção de wrap se desliga
+// quando nenhum LED está em transição.
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "pico/stdlib.h"
+#include "hardware/pwm.h"
+#include "bibliotecas/led_pwm.h"
+#include "mock_pwm.h"
+
+#define UPDATE_RATE_HZ 1000
+#define WRAPS_PER_UPDATE (125000000u / (LED_PWM_WRAP + 1) / UPDATE_RATE_HZ)
+
+static const uint32_t pins[] = {12, 13}; // Azul e vermelho, os dois no slice 6
+static unsigned failures;
+
+static void check(bool ok, const char *name)
+{
+  printf("%-52s %s\n", name, ok ? "ok" : "FALHOU");
+  if (!ok)
+    failures++;
+}
+
+// Avança uma atualização por vez até o canal chegar a `target`; confere a
+// cada passo que o brilho anda na direção certa, sem passar do alvo, e que o
+// PWM recebe a gama dele. Retorna as atualizações gastas (ou ~0u se falhar).
+static unsigned fade_updates(size_t channel, uint16_t target, unsigned limit)
+{
+  uint16_t previous = led_pwm_brightness(channel);
+  bool rising = target > previous;
+  for (unsigned updates = 1; updates <= limit; ++updates)
+  {
+    mock_pwm_wrap(WRAPS_PER_UPDATE);
+    uint16_t now = led_pwm_brightness(channel);
+    bool ordered = rising ? (now >= previous && now <= target) : (now <= previous && now >= target);
+    if (!ordered || mock_pwm_level(pins[channel]) != led_pwm_gamma(now))
+      return ~0u;
+    if (now == target)
+      return updates;
+    previous = now;
+  }
+  return ~0u;
+}
+
+int main(void)
+{
+  led_pwm_init(pins, 2, UPDATE_RATE_HZ);
+
+  // Curva gama: extremos, sem descer e próxima de x^2.2 (interpolada)
+  bool monotonic = true, close = true;
+  for (uint16_t b = 1; b <= LED_PWM_WRAP; ++b)
+  {
+    monotonic &= led_pwm_gamma(b) >= led_pwm_gamma(b - 1);
+    double ideal = pow((double)b / LED_PWM_WRAP, 2.2) * LED_PWM_WRAP;
+    close &= fabs(led_pwm_gamma(b) - ideal) < 4.0;
+  }
+  check(led_pwm_gamma(0) == 0 && led_pwm_gamma(LED_PWM_WRAP) == LED_PWM_WRAP && led_pwm_gamma(60000) == LED_PWM_WRAP,
+        "gama: 0 e LED_PWM_WRAP nos extremos");
+  check(monotonic, "gama: nunca desce");
+  check(close, "gama: a menos de 4 níveis de x^2.2");
+  check(!mock_pwm_irq_enabled(6) && mock_pwm_wrap(1000) == 0, "parado: interrupção desligada");
+
+  // 100 ms a 1 kHz: 100 atualizações (mais uma pelo resto da divisão)
+  led_pwm_set(0, LED_PWM_WRAP, 100);
+  unsigned updates = fade_updates(0, LED_PWM_WRAP, 200);
+  check(updates >= 100 && updates <= 101, "subida de 100 ms em ~100 atualizações");
+  check(mock_pwm_level(pins[0]) == LED_PWM_WRAP && led_pwm_brightness(1) == 0, "alvo exato, outro canal parado");
+  check(!mock_pwm_irq_enabled(6) && mock_pwm_wrap(1000) == 0, "fim da transição desliga a interrupção");
+
+  // Descida de 300 ms até a metade
+  led_pwm_set(0, 2048, 300);
+  updates = fade_updates(0, 2048, 600);
+  check(updates >= 300 && updates <= 301, "descida de 300 ms em ~300 atualizações");
+
+  // Novo alvo no meio da transição: segue do brilho atual até ele
+  led_pwm_set(1, 3000, 200);
+  mock_pwm_wrap(50 * WRAPS_PER_UPDATE);
+  uint16_t halfway = led_pwm_brightness(1);
+  led_pwm_set(1, 500, 100);
+  updates = fade_updates(1, 500, 200);
+  check(halfway > 500 && halfway < 3000 && updates >= 100 && updates <= 101, "novo alvo no meio da transição");
+
+  // Desligar vai tudo a 0 guardando os alvos; religar volta a eles
+  led_pwm_set_enabled(false, 0);
+  mock_pwm_wrap(WRAPS_PER_UPDATE);
+  check(led_pwm_brightness(0) == 0 && led_pwm_brightness(1) == 0 && mock_pwm_level(pins[0]) == 0,
+        "desligar sem transição: 0 na atualização seguinte");
+  led_pwm_set_enabled(true, 50);
+  updates = fade_updates(0, 2048, 100);
+  check(updates >= 50 && updates <= 51 && led_pwm_brightness(1) == 500, "religar volta aos alvos guardados");
+
+  // Mesmo alvo de novo: nada a fazer, a interrupção continua desligada
+  led_pwm_set(0, 2048, 100);
+  check(!mock_pwm_irq_enabled(6), "mesmo alvo não liga a interrupção");
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,98 @@
+// Testes do desenho só na mudança (bibliotecas/presented_state.c): um
+// joystick parado com ruído abaixo da histerese não gera quadros, um
+// movimento gera um quadro só, e um quadro não apresentado é refeito. A
+// posição do quadrado sai da leitura aceita numa escala linear, como a do
+// joystick calibrado num display de 128x64.
+#include <stdio.h>
+#include <stdlib.h>
+#include "bibliotecas/presented_state.h"
+
+#define HYSTERESIS 24
+#define RANGE_X (128 - 8) // Posições do quadrado de 8x8
+#define RANGE_Y (64 - 8)
+#define SAMPLES 2000
+
+static presented_state_t state;
+static unsigned failures;
+
+static void check(bool ok, const char *name)
+{
+  printf("%-52s %s\n", name, ok ? "ok" : "FALHOU");
+  if (!ok)
+    failures++;
+}
+
+// Um quadro do laço principal: histerese nos dois eixos, posição do quadrado
+// e decisão de desenhar. Retorna se o quadro seria desenhado.
+static bool frame(uint16_t adc_x, uint16_t adc_y, uint8_t style)
+{
+  adc_x = presented_state_hold_adc(&state, 0, adc_x);
+  adc_y = presented_state_hold_adc(&state, 1, adc_y);
+  presented_screen_t screen = {
+      .square_x = adc_x * RANGE_X / 4095,
+      .square_y = (4095 - adc_y) * RANGE_Y / 4095,
+      .border_style = style,
+  };
+  return presented_state_set_screen(&state, &screen);
+}
+
+// Leitura com ruído uniforme de até `noise` contagens em volta de `center`
+static uint16_t noisy(uint16_t center, int noise)
+{
+  return center + rand() % (2 * noise + 1) - noise;
+}
+
+// Quadros desenhados em SAMPLES leituras em volta de (x, y)
+static unsigned frames_at(uint16_t x, uint16_t y, int noise)
+{
+  unsigned drawn = 0;
+  for (unsigned n = 0; n < SAMPLES; ++n)
+    drawn += frame(noisy(x, noise), noisy(y, noise), 0);
+  return drawn;
+}
+
+int main(void)
+{
+  srand(1);
+  presented_state_init(&state, HYSTERESIS);
+
+  check(frame(2048, 2048, 0), "primeiro quadro sempre desenhado");
+  check(frames_at(2048, 2048, HYSTERESIS) == 0, "parado com ruído na histerese: nenhum quadro");
+
+  // A primeira leitura da nova posição é aceita com o ruído dela; metade da
+  // histerese para cada lado nunca passa dela
+  check(frames_at(3000, 1000, HYSTERESIS / 2) == 1, "movimento: um quadro, depois parado de novo");
+  uint16_t held_x = state.held_adc[0], held_y = state.held_adc[1];
+  check(abs(held_x - 3000) <= HYSTERESIS / 2 && abs(held_y - 1000) <= HYSTERESIS / 2, "valor aceito perto da nova posição");
+
+  // Passo logo acima da histerese é aceito; logo abaixo, não
+  check(presented_state_hold_adc(&state, 0, held_x + HYSTERESIS) == held_x, "variação igual à histerese ignorada");
+  check(presented_state_hold_adc(&state, 0, held_x + HYSTERESIS + 1) == held_x + HYSTERESIS + 1,
+        "variação acima da histerese aceita");
+
+  // Leituras iguais com outro estilo de borda: um quadro
+  uint16_t x = state.held_adc[0], y = state.held_adc[1];
+  frame(x, y, 0);
+  check(frame(x, y, 3) && !frame(x, y, 3), "troca de estilo: um quadro");
+
+  // Quadro não apresentado (pipeline sem buffer livre): refeito no próximo
+  presented_state_invalidate(&state);
+  check(frame(x, y, 3) && !frame(x, y, 3), "quadro invalidado é refeito uma vez");
+
+  // Campos do HUD também contam como mudança
+  presented_screen_t screen = state.screen;
+  screen.fps = 49;
+  check(presented_state_set_screen(&state, &screen) && !presented_state_set_screen(&state, &screen),
+        "HUD: nova leitura de FPS gera quadro");
+
+  // Sem histerese, qualquer ruído que mude a posição gera quadro
+  presented_state_init(&state, 0);
+  check(frames_at(2048, 2048, HYSTERESIS) > SAMPLES / 4, "sem histerese: ruído gera quadros");
+
+  // PWM: só muda quando os níveis mudam
+  check(presented_state_set_pwm(&state, 100, 200) && !presented_state_set_pwm(&state, 100, 200) &&
+            presented_state_set_pwm(&state, 100, 201),
+        "PWM atualizado só quando os níveis mudam");
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,195 @@
+// Testes das primitivas por byte (fill, rect, hline, vline, line): cada uma
+// é comparada, sobre um quadro aleatório, com um modelo que pinta pixel a
+// pixel como a versão original em ssd1306_pixel. Também confere que todo
+// byte alterado cai dentro da região marcada e que ssd1306_send_dirty deixa
+// a GDDRAM simulada igual ao ram_buffer.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "bibliotecas/ssd1306.h"
+#include "mock_display.h"
+
+#define CASES 20000
+
+static ssd1306_t ssd;
+static mock_display_t display;
+static uint8_t before[SSD1306_BUFFER_SIZE(WIDTH, HEIGHT)];
+static uint8_t expected[SSD1306_BUFFER_SIZE(WIDTH, HEIGHT)];
+static unsigned failures;
+
+static void ref_pixel(int x, int y, bool value)
+{
+  if (x < 0 || y < 0 || x >= WIDTH || y >= HEIGHT)
+    return;
+  uint8_t *byte = &expected[ssd1306_index(&ssd, x, y >> 3)];
+  if (value)
+    *byte |= 1 << (y & 0b111);
+  else
+    *byte &= ~(1 << (y & 0b111));
+}
+
+static void ref_rect(int top, int left, int width, int height, bool value, bool fill)
+{
+  for (int x = left; x < left + width; ++x)
+  {
+    ref_pixel(x, top, value);
+    ref_pixel(x, top + height - 1, value);
+  }
+  for (int y = top; y < top + height; ++y)
+  {
+    ref_pixel(left, y, value);
+    ref_pixel(left + width - 1, y, value);
+  }
+  if (fill)
+  {
+    for (int x = left + 1; x < left + width - 1; ++x)
+      for (int y = top + 1; y < top + height - 1; ++y)
+        ref_pixel(x, y, value);
+  }
+}
+
+static void ref_line(int x0, int y0, int x1, int y1, bool value)
+{
+  int dx = abs(x1 - x0), dy = abs(y1 - y0);
+  int sx = x0 < x1 ? 1 : -1, sy = y0 < y1 ? 1 : -1;
+  int err = dx - dy;
+  while (true)
+  {
+    ref_pixel(x0, y0, value);
+    if (x0 == x1 && y0 == y1)
+      break;
+    int e2 = err * 2;
+    if (e2 > -dy)
+    {
+      err -= dy;
+      x0 += sx;
+    }
+    if (e2 < dx)
+    {
+      err += dx;
+      y0 += sy;
+    }
+  }
+}
+
+// Quadro aleatório já enviado, com a região alterada vazia
+static void start_case(void)
+{
+  for (size_t i = 1; i < ssd.bufsize; ++i)
+    ssd.ram_buffer[i] = rand();
+  ssd1306_send_data(&ssd);
+  memcpy(before, ssd.ram_buffer, ssd.bufsize);
+  memcpy(expected, ssd.ram_buffer, ssd.bufsize);
+}
+
+static void finish_case(const char *name, unsigned n)
+{
+  if (memcmp(ssd.ram_buffer, expected, ssd.bufsize) != 0)
+  {
+    printf("%s #%u: ram_buffer difere do desenho pixel a pixel\n", name, n);
+    failures++;
+    return;
+  }
+
+  for (uint8_t x = 0; x < ssd.width; ++x)
+  {
+    for (uint8_t page = 0; page < ssd.pages; ++page)
+    {
+      uint16_t i = ssd1306_index(&ssd, x, page);
+      bool inside = x >= ssd.dirty_x0 && x <= ssd.dirty_x1 && page >= ssd.dirty_page0 && page <= ssd.dirty_page1;
+      if (before[i] != ssd.ram_buffer[i] && !inside)
+      {
+        printf("%s #%u: coluna %u, página %u mudou fora da região marcada (%u-%u, páginas %u-%u)\n", name, n, x,
+               page, ssd.dirty_x0, ssd.dirty_x1, ssd.dirty_page0, ssd.dirty_page1);
+        failures++;
+        return;
+      }
+    }
+  }
+
+  ssd1306_send_dirty(&ssd);
+  if (!mock_display_matches(&display, &ssd))
+  {
+    printf("%s #%u: GDDRAM simulada difere depois de send_dirty\n", name, n);
+    failures++;
+  }
+}
+
+static void report(const char *name, unsigned before_failures)
+{
+  printf("%-24s %s\n", name, failures == before_failures ? "ok" : "FALHOU");
+}
+
+int main(void)
+{
+  ssd1306_init(&ssd, WIDTH, HEIGHT, false, 0x3C, NULL);
+  mock_display_attach(&ssd, &display);
+  srand(1);
+
+  unsigned start = failures;
+  for (unsigned n = 0; n < 4; ++n)
+  {
+    start_case();
+    ssd1306_fill(&ssd, n & 1);
+    memset(expected + 1, (n & 1) ? 0xFF : 0x00, ssd.bufsize - 1);
+    finish_case("ssd1306_fill", n);
+  }
+  report("ssd1306_fill", start);
+
+  start = failures;
+  for (unsigned n = 0; n < CASES; ++n)
+  {
+    int left = rand() % WIDTH, top = rand() % HEIGHT;
+    int width = 1 + rand() % (WIDTH - left), height = 1 + rand() % (HEIGHT - top);
+    bool value = rand() & 1, fill = rand() & 1;
+    start_case();
+    ssd1306_rect(&ssd, top, left, width, height, value, fill);
+    ref_rect(top, left, width, height, value, fill);
+    finish_case("ssd1306_rect", n);
+  }
+  report("ssd1306_rect", start);
+
+  start = failures;
+  for (unsigned n = 0; n < CASES; ++n)
+  {
+    int x0 = rand() % WIDTH, x1 = x0 + rand() % (WIDTH - x0), y = rand() % HEIGHT;
+    bool value = rand() & 1;
+    start_case();
+    ssd1306_hline(&ssd, x0, x1, y, value);
+    ref_line(x0, y, x1, y, value);
+    finish_case("ssd1306_hline", n);
+  }
+  report("ssd1306_hline", start);
+
+  start = failures;
+  for (unsigned n = 0; n < CASES; ++n)
+  {
+    int x = rand() % WIDTH, y0 = rand() % HEIGHT, y1 = y0 + rand() % (HEIGHT - y0);
+    bool value = rand() & 1;
+    start_case();
+    ssd1306_vline(&ssd, x, y0, y1, value);
+    ref_line(x, y0, x, y1, value);
+    finish_case("ssd1306_vline", n);
+  }
+  report("ssd1306_vline", start);
+
+  // Metade das linhas alinhadas aos eixos (caminho por bytes), metade diagonais
+  start = failures;
+  for (unsigned n = 0; n < CASES; ++n)
+  {
+    int x0 = rand() % WIDTH, y0 = rand() % HEIGHT, x1 = rand() % WIDTH, y1 = rand() % HEIGHT;
+    if (n % 4 == 0)
+      y1 = y0;
+    else if (n % 4 == 1)
+      x1 = x0;
+    bool value = rand() & 1;
+    start_case();
+    ssd1306_line(&ssd, x0, y0, x1, y1, value);
+    ref_line(x0, y0, x1, y1, value);
+    finish_case("ssd1306_line", n);
+  }
+  report("ssd1306_line", start);
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,95 @@
+// Comandos da rolagem por hardware gravados no barramento I2C simulado:
+// confere byte a byte a sequência de cada chamada (byte de controle 0x00 +
+// comandos do datasheet) e termina com erro se alguma for diferente.
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "bibliotecas/ssd1306.h"
+#include "mock_bus.h"
+#include "mock_display.h"
+
+static ssd1306_t ssd;
+static unsigned failures;
+
+static void expect(const char *name, const uint8_t *expected, size_t length)
+{
+  bool ok = mock_bus.transactions == 1 && mock_bus.recorded_length == length &&
+            memcmp(mock_bus.recorded, expected, length) == 0;
+  printf("%-36s", name);
+  for (size_t i = 0; i < mock_bus.recorded_length; ++i)
+    printf(" %02X", mock_bus.recorded[i]);
+  printf("  %s\n", ok ? "ok" : "FALHOU");
+  if (!ok)
+  {
+    printf("%-36s", "  esperado");
+    for (size_t i = 0; i < length; ++i)
+      printf(" %02X", expected[i]);
+    printf("\n");
+    failures++;
+  }
+  mock_bus_reset();
+}
+
+#define EXPECT(name, ...)                              \
+  do                                                   \
+  {                                                    \
+    const uint8_t expected[] = {__VA_ARGS__};          \
+    expect(name, expected, sizeof(expected));          \
+  } while (0)
+
+int main(void)
+{
+  i2c_init(i2c1, 400 * 1000);
+  ssd1306_init(&ssd, WIDTH, HEIGHT, false, 0x3C, i2c1);
+  mock_bus_reset();
+
+  // Rolagem horizontal: para a anterior, 26h/27h, dummy, página inicial,
+  // intervalo, página final, dummies 00h e FFh, e liga
+  ssd1306_scroll_horizontal(&ssd, false, 0, 7, SSD1306_SCROLL_2_FRAMES);
+  EXPECT("horizontal direita, páginas 0-7", 0x00, 0x2E, 0x26, 0x00, 0x00, 0x07, 0x07, 0x00, 0xFF, 0x2F);
+  ssd1306_scroll_horizontal(&ssd, true, 2, 5, SSD1306_SCROLL_5_FRAMES);
+  EXPECT("horizontal esquerda, páginas 2-5", 0x00, 0x2E, 0x27, 0x00, 0x02, 0x00, 0x05, 0x00, 0xFF, 0x2F);
+  ssd1306_scroll_horizontal(&ssd, false, 9, 15, SSD1306_SCROLL_256_FRAMES);
+  EXPECT("horizontal, páginas fora de 0-7", 0x00, 0x2E, 0x26, 0x00, 0x01, 0x03, 0x07, 0x00, 0xFF, 0x2F);
+
+  // Diagonal: 29h/2Ah, dummy, página inicial, intervalo, página final e
+  // deslocamento vertical (6 bits)
+  ssd1306_scroll_diagonal(&ssd, false, 0, 7, SSD1306_SCROLL_2_FRAMES, 1);
+  EXPECT("diagonal direita, 1 linha", 0x00, 0x2E, 0x29, 0x00, 0x00, 0x07, 0x07, 0x01, 0x2F);
+  ssd1306_scroll_diagonal(&ssd, true, 1, 3, SSD1306_SCROLL_64_FRAMES, 63);
+  EXPECT("diagonal esquerda, 63 linhas", 0x00, 0x2E, 0x2A, 0x00, 0x01, 0x01, 0x03, 0x3F, 0x2F);
+  ssd1306_scroll_diagonal(&ssd, false, 0, 7, SSD1306_SCROLL_2_FRAMES, 65);
+  EXPECT("diagonal, passo maior que 63", 0x00, 0x2E, 0x29, 0x00, 0x00, 0x07, 0x07, 0x01, 0x2F);
+
+  ssd1306_set_vertical_scroll_area(&ssd, 8, 56);
+  EXPECT("área vertical 8 fixas + 56", 0x00, 0xA3, 0x08, 0x38);
+  ssd1306_set_vertical_scroll_area(&ssd, 0, 64);
+  EXPECT("área vertical tela inteira", 0x00, 0xA3, 0x00, 0x40);
+
+  ssd1306_scroll_stop(&ssd);
+  EXPECT("stop", 0x00, 0x2E);
+
+  ssd1306_set_start_line(&ssd, 0);
+  EXPECT("start line 0", 0x00, 0x40);
+  ssd1306_set_start_line(&ssd, 37);
+  EXPECT("start line 37", 0x00, 0x65);
+  ssd1306_set_start_line(&ssd, 64);
+  EXPECT("start line 64 (volta a 0)", 0x00, 0x40);
+
+  // Depois dos comandos de rolagem, com seus argumentos, o endereçamento
+  // ainda é interpretado certo: a GDDRAM simulada recebe o quadro
+  static ssd1306_t simulated;
+  static mock_display_t display;
+  ssd1306_init(&simulated, WIDTH, HEIGHT, false, 0x3C, NULL);
+  mock_display_attach(&simulated, &display);
+  ssd1306_scroll_diagonal(&simulated, true, 0, 7, SSD1306_SCROLL_2_FRAMES, 3);
+  ssd1306_set_vertical_scroll_area(&simulated, 0, 64);
+  ssd1306_draw_string(&simulated, "rolagem", 10, 20);
+  ssd1306_send_dirty(&simulated);
+  bool matches = mock_display_matches(&display, &simulated);
+  printf("%-36s %s\n", "envio depois da rolagem", matches ? "ok" : "FALHOU");
+  if (!matches)
+    failures++;
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,94 @@
+// Bytes que ssd1306_send_dirty coloca no barramento I2C simulado para
+// alterações de tamanhos diferentes: a janela (byte de controle 0x00 + 6
+// comandos) e os dados (0x40 + bytes da janela, em blocos de até 256 por
+// transação). Termina com erro se alguma contagem for diferente.
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "bibliotecas/ssd1306.h"
+#include "mock_bus.h"
+
+#define WINDOW_BYTES 7        // 0x00 + SET_COL_ADDR x0 x1 + SET_PAGE_ADDR p0 p1
+#define WINDOW_TRANSACTIONS 1 // Os comandos vão numa transação só
+#define CHUNK 256             // SSD1306_DIRTY_CHUNK
+
+static ssd1306_t ssd;
+static unsigned failures;
+
+static void expect_bus(const char *name, size_t bytes, size_t transactions)
+{
+  bool ok = mock_bus.bytes == bytes && mock_bus.transactions == transactions;
+  printf("%-28s %5zu bytes %2zu transacoes  %s\n", name, mock_bus.bytes, mock_bus.transactions, ok ? "ok" : "FALHOU");
+  if (!ok)
+  {
+    printf("%-28s esperado %zu bytes em %zu transacoes\n", "", bytes, transactions);
+    failures++;
+  }
+}
+
+static void expect_recorded(const char *name, const uint8_t *expected, size_t length)
+{
+  if (mock_bus.recorded_length != length || memcmp(mock_bus.recorded, expected, length) != 0)
+  {
+    printf("%-28s bytes enviados diferentes do esperado\n", name);
+    failures++;
+  }
+}
+
+// Quadro apagado e já enviado: a próxima alteração parte de uma região vazia
+static void start_case(void)
+{
+  ssd1306_fill(&ssd, false);
+  ssd1306_send_data(&ssd);
+  mock_bus_reset();
+}
+
+int main(void)
+{
+  i2c_init(i2c1, 400 * 1000);
+  ssd1306_init(&ssd, WIDTH, HEIGHT, false, 0x3C, i2c1);
+
+  start_case();
+  ssd1306_send_dirty(&ssd);
+  expect_bus("sem alteracao", 0, 0);
+
+  // Um pixel: janela de uma coluna e uma página, um byte de dados
+  start_case();
+  ssd1306_pixel(&ssd, 70, 29, true);
+  ssd1306_send_dirty(&ssd);
+  expect_bus("um pixel", WINDOW_BYTES + 1 + 1, WINDOW_TRANSACTIONS + 1);
+  const uint8_t pixel[] = {0x00, SET_COL_ADDR, 70, 70, SET_PAGE_ADDR, 3, 3, 0x40, 1 << (29 & 7)};
+  expect_recorded("um pixel", pixel, sizeof(pixel));
+
+  // Linha inteira numa página: 128 bytes num único bloco
+  start_case();
+  ssd1306_hline(&ssd, 0, WIDTH - 1, 29, true);
+  ssd1306_send_dirty(&ssd);
+  expect_bus("uma pagina (128 colunas)", WINDOW_BYTES + 1 + WIDTH, WINDOW_TRANSACTIONS + 1);
+
+  // Mesma página duas vezes antes do envio: a região cobre só as duas colunas
+  // e o que há entre elas
+  start_case();
+  ssd1306_pixel(&ssd, 16, 8, true);
+  ssd1306_pixel(&ssd, 31, 13, true);
+  ssd1306_send_dirty(&ssd);
+  expect_bus("dois pixels na pagina 1", WINDOW_BYTES + 1 + 16, WINDOW_TRANSACTIONS + 1);
+
+  // 64 colunas x 5 páginas = 320 bytes: dois blocos (256 + 64)
+  start_case();
+  ssd1306_rect(&ssd, 16, 32, 64, 40, true, true);
+  ssd1306_send_dirty(&ssd);
+  expect_bus("64 colunas x 5 paginas", WINDOW_BYTES + (1 + CHUNK) + (1 + 64), WINDOW_TRANSACTIONS + 2);
+
+  // Quadro inteiro: colunas completas vão direto do ram_buffer, numa transação
+  start_case();
+  ssd1306_fill(&ssd, true);
+  ssd1306_send_dirty(&ssd);
+  expect_bus("quadro inteiro", WINDOW_BYTES + 1 + WIDTH * HEIGHT / 8, WINDOW_TRANSACTIONS + 1);
+
+  mock_bus_reset();
+  ssd1306_send_data(&ssd);
+  expect_bus("ssd1306_send_data", WINDOW_BYTES + 1 + WIDTH * HEIGHT / 8, WINDOW_TRANSACTIONS + 1);
+
+  return failures ? 1 : 0;
+}
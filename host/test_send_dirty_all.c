@@ -0,0 +1,109 @@
+// Testes de ssd1306_send_dirty_all com vários displays: cada controlador
+// recebe só as janelas dos seus displays (128x64 no i2c0 e 128x32 no i2c1,
+// em paralelo), displays no mesmo barramento são enviados um depois do outro
+// sem perder bytes, displays sem DMA caem no envio bloqueante e o callback
+// vem uma vez por display.
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "bibliotecas/ssd1306.h"
+#include "mock_bus.h"
+
+#define WINDOW_BYTES 7 // 0x00 + SET_COL_ADDR x0 x1 + SET_PAGE_ADDR p0 p1
+
+static ssd1306_t large, small, shared, plain;
+static unsigned callbacks_large, callbacks_small, callbacks_shared;
+static unsigned failures;
+
+static void check(bool ok, const char *name)
+{
+  printf("%-52s %s\n", name, ok ? "ok" : "FALHOU");
+  if (!ok)
+    failures++;
+}
+
+static void on_flush_done(ssd1306_t *display)
+{
+  if (display == &large)
+    callbacks_large++;
+  else if (display == &small)
+    callbacks_small++;
+  else if (display == &shared)
+    callbacks_shared++;
+}
+
+// Bytes de uma janela enviada por send_dirty: comandos + 0x40 + dados
+static size_t window_bytes(uint8_t columns, uint8_t pages)
+{
+  return WINDOW_BYTES + 1 + (size_t)columns * pages;
+}
+
+static void start_case(ssd1306_t *const *displays, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    ssd1306_fill(displays[i], false);
+    ssd1306_send_data(displays[i]);
+  }
+  callbacks_large = callbacks_small = callbacks_shared = 0;
+  mock_bus_reset();
+}
+
+int main(void)
+{
+  i2c_init(i2c0, 400 * 1000);
+  i2c_init(i2c1, 400 * 1000);
+  ssd1306_init(&large, 128, 64, false, 0x3C, i2c0);
+  ssd1306_init(&small, 128, 32, false, 0x3C, i2c1);
+  ssd1306_init(&shared, 128, 32, false, 0x3D, i2c1);
+  ssd1306_init(&plain, 128, 64, false, 0x3D, i2c0);
+  bool dma_ok = ssd1306_async_init(&large, on_flush_done);
+  dma_ok &= ssd1306_async_init(&small, on_flush_done);
+  dma_ok &= ssd1306_async_init(&shared, on_flush_done);
+  check(dma_ok, "async_init nos três displays com DMA");
+
+  // Controladores diferentes: cada um leva só a janela do seu display
+  ssd1306_t *pair[] = {&large, &small};
+  start_case(pair, 2);
+  ssd1306_rect(&large, 40, 10, 20, 16, true, true); // colunas 10..29, páginas 5..6
+  ssd1306_pixel(&small, 100, 30, true);             // coluna 100, página 3
+  ssd1306_send_dirty_all(pair, 2);
+  check(mock_bus_ports[0].bytes == window_bytes(20, 2) && mock_bus_ports[0].transactions == 2,
+        "i2c0: só a janela do 128x64");
+  check(mock_bus_ports[1].bytes == window_bytes(1, 1) && mock_bus_ports[1].transactions == 2,
+        "i2c1: só a janela do 128x32");
+  check(callbacks_large == 1 && callbacks_small == 1, "um callback por display");
+  check(!ssd1306_flush_busy(&large) && !ssd1306_flush_busy(&small) && large.dirty_x0 > large.dirty_x1 &&
+            small.dirty_x0 > small.dirty_x1,
+        "envios terminados e regiões alteradas vazias");
+
+  // Mesmo barramento: os dois envios vão inteiros, um depois do outro
+  ssd1306_t *same_bus[] = {&small, &shared};
+  start_case(same_bus, 2);
+  ssd1306_fill(&small, true);
+  ssd1306_hline(&shared, 0, 127, 9, true);
+  ssd1306_send_dirty_all(same_bus, 2);
+  check(mock_bus_ports[1].bytes == window_bytes(128, 4) + window_bytes(128, 1) &&
+            mock_bus_ports[1].transactions == 4 && mock_bus_ports[0].bytes == 0,
+        "mesmo barramento: soma das duas janelas");
+  check(callbacks_small == 1 && callbacks_shared == 1, "mesmo barramento: um callback por display");
+
+  // Display sem DMA no meio da lista: envio bloqueante com os mesmos bytes
+  ssd1306_t *mixed[] = {&large, &plain, &small};
+  start_case(mixed, 3);
+  ssd1306_pixel(&large, 0, 0, true);
+  ssd1306_pixel(&plain, 127, 63, true);
+  ssd1306_pixel(&small, 64, 16, true);
+  ssd1306_send_dirty_all(mixed, 3);
+  check(mock_bus_ports[0].bytes == 2 * window_bytes(1, 1) && mock_bus_ports[1].bytes == window_bytes(1, 1),
+        "sem DMA: envio bloqueante junto com os outros");
+  check(plain.dirty_x0 > plain.dirty_x1 && callbacks_large == 1 && callbacks_small == 1,
+        "sem DMA: região vazia, callbacks dos outros");
+
+  // Nada alterado: nenhum byte em nenhum barramento
+  mock_bus_reset();
+  ssd1306_send_dirty_all(mixed, 3);
+  check(mock_bus.bytes == 0, "sem alteração, sem envio");
+
+  return failures ? 1 : 0;
+}
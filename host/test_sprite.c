@@ -0,0 +1,152 @@
+// Testes dos sprites (ssd1306_sprite_*): sobre um quadro aleatório, cada
+// movimento é comparado com um modelo que pinta pixel a pixel, esconder o
+// sprite devolve o fundo exato (modo BACKGROUND) ou desfaz o XOR, todo byte
+// alterado cai dentro da região marcada e os limites são respeitados, com
+// posições em parte fora da tela.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "bibliotecas/ssd1306.h"
+
+#define CASES 5000
+#define SPRITE_W 11
+#define SPRITE_H 13
+
+static ssd1306_t ssd;
+static uint8_t scene[WIDTH * HEIGHT / 8 + 1];
+static uint8_t expected[WIDTH * HEIGHT / 8 + 1];
+static uint8_t before[WIDTH * HEIGHT / 8 + 1];
+static uint8_t bitmap[SPRITE_W * ((SPRITE_H + 7) / 8)];
+static uint8_t background[SSD1306_SPRITE_BACKGROUND_SIZE(SPRITE_W, SPRITE_H)];
+static unsigned failures;
+
+static void check(bool ok, const char *name)
+{
+  printf("%-52s %s\n", name, ok ? "ok" : "FALHOU");
+  if (!ok)
+    failures++;
+}
+
+static bool bitmap_pixel(int i, int row)
+{
+  return bitmap[i * ((SPRITE_H + 7) / 8) + (row >> 3)] & (1 << (row & 7));
+}
+
+// O sprite em (x, y) sobre `scene`: opaco no modo BACKGROUND, XOR no outro
+static void ref_sprite(int x, int y, bool xor_mode)
+{
+  memcpy(expected, scene, ssd.bufsize);
+  for (int i = 0; i < SPRITE_W; ++i)
+  {
+    for (int row = 0; row < SPRITE_H; ++row)
+    {
+      int px = x + i, py = y + row;
+      if (px < 0 || py < 0 || px >= WIDTH || py >= HEIGHT)
+        continue;
+      uint8_t *byte = &expected[ssd1306_index(&ssd, px, py >> 3)];
+      uint8_t bit = 1 << (py & 7);
+      if (xor_mode)
+        *byte ^= bitmap_pixel(i, row) ? bit : 0;
+      else if (bitmap_pixel(i, row))
+        *byte |= bit;
+      else
+        *byte &= ~bit;
+    }
+  }
+}
+
+// Bytes alterados desde `before` fora da região marcada
+static bool changes_inside_dirty(void)
+{
+  for (uint8_t x = 0; x < ssd.width; ++x)
+  {
+    for (uint8_t page = 0; page < ssd.pages; ++page)
+    {
+      uint16_t i = ssd1306_index(&ssd, x, page);
+      bool inside = x >= ssd.dirty_x0 && x <= ssd.dirty_x1 && page >= ssd.dirty_page0 && page <= ssd.dirty_page1;
+      if (before[i] != ssd.ram_buffer[i] && !inside)
+        return false;
+    }
+  }
+  return true;
+}
+
+static void start_step(void)
+{
+  memcpy(before, ssd.ram_buffer, ssd.bufsize);
+  ssd1306_clear_dirty(&ssd);
+}
+
+static void run_mode(ssd1306_sprite_mode_t mode, const char *name_moves, const char *name_hide)
+{
+  static ssd1306_sprite_t sprite;
+  scene[0] = ssd.ram_buffer[0];
+  for (size_t i = 1; i < ssd.bufsize; ++i)
+    scene[i] = ssd.ram_buffer[i] = rand();
+  ssd1306_sprite_init(&sprite, SPRITE_W, SPRITE_H, bitmap, mode, mode == SSD1306_SPRITE_XOR ? NULL : background);
+
+  bool moves_ok = true, hide_ok = true;
+  for (unsigned n = 0; n < CASES && moves_ok && hide_ok; ++n)
+  {
+    int x = rand() % (WIDTH + 2 * SPRITE_W) - SPRITE_W;
+    int y = rand() % (HEIGHT + 2 * SPRITE_H) - SPRITE_H;
+    start_step();
+    ssd1306_sprite_move(&ssd, &sprite, x, y);
+    ref_sprite(x, y, mode == SSD1306_SPRITE_XOR);
+    moves_ok &= memcmp(ssd.ram_buffer, expected, ssd.bufsize) == 0 && changes_inside_dirty();
+
+    // De vez em quando esconde: o quadro volta a ser exatamente o de antes
+    if (n % 7 == 0)
+    {
+      start_step();
+      ssd1306_sprite_hide(&ssd, &sprite);
+      hide_ok &= memcmp(ssd.ram_buffer, scene, ssd.bufsize) == 0 && changes_inside_dirty();
+    }
+  }
+  check(moves_ok, name_moves);
+  check(hide_ok, name_hide);
+  ssd1306_sprite_hide(&ssd, &sprite);
+}
+
+int main(void)
+{
+  ssd1306_init(&ssd, WIDTH, HEIGHT, false, 0x3C, NULL);
+  srand(1);
+  for (size_t i = 0; i < sizeof(bitmap); ++i)
+    bitmap[i] = rand();
+
+  run_mode(SSD1306_SPRITE_BACKGROUND, "BACKGROUND: movimentos iguais ao modelo",
+           "BACKGROUND: esconder devolve o fundo");
+  run_mode(SSD1306_SPRITE_XOR, "XOR: movimentos iguais ao modelo", "XOR: esconder desfaz o desenho");
+
+  // Mesma posição: nada muda e nada é marcado
+  static ssd1306_sprite_t sprite;
+  ssd1306_sprite_init(&sprite, SPRITE_W, SPRITE_H, bitmap, SSD1306_SPRITE_BACKGROUND, background);
+  ssd1306_sprite_move(&ssd, &sprite, 40, 20);
+  start_step();
+  ssd1306_sprite_move(&ssd, &sprite, 40, 20);
+  check(ssd.dirty_x0 > ssd.dirty_x1 && memcmp(ssd.ram_buffer, before, ssd.bufsize) == 0,
+        "mover para a mesma posição não marca nada");
+
+  // Limites: posições pedidas fora deles são trazidas para dentro
+  ssd1306_sprite_set_bounds(&sprite, 2, WIDTH - SPRITE_W - 2, 3, HEIGHT - SPRITE_H - 3);
+  ssd1306_sprite_move(&ssd, &sprite, -50, 200);
+  bool clamped = sprite.x == 2 && sprite.y == HEIGHT - SPRITE_H - 3;
+  ssd1306_sprite_move(&ssd, &sprite, 500, -9);
+  clamped &= sprite.x == WIDTH - SPRITE_W - 2 && sprite.y == 3;
+  check(clamped, "posição presa aos limites");
+  ssd1306_sprite_hide(&ssd, &sprite);
+
+  // Sprite sólido igual ao retângulo preenchido de draw_square
+  static ssd1306_sprite_t solid;
+  ssd1306_fill(&ssd, false);
+  ssd1306_sprite_init(&solid, SQUARE_SIZE, SQUARE_SIZE, NULL, SSD1306_SPRITE_XOR, NULL);
+  ssd1306_sprite_stamp(&ssd, &solid, 37, 21);
+  memcpy(before, ssd.ram_buffer, ssd.bufsize);
+  ssd1306_fill(&ssd, false);
+  ssd1306_rect(&ssd, 21, 37, SQUARE_SIZE, SQUARE_SIZE, true, true);
+  check(memcmp(before, ssd.ram_buffer, ssd.bufsize) == 0, "sprite sólido igual a ssd1306_rect preenchido");
+
+  return failures ? 1 : 0;
+}
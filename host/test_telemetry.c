@@ -0,0 +1,130 @@
+// Testes do logger de telemetria (bibliotecas/telemetry.c): o limite de taxa
+// com o intervalo do main.c não descarta quadros normais com jitter, e cada
+// quadro serializado leva os dois contadores de descarte separados, como
+// host/decode_telemetry.py espera.
+#include <stdio.h>
+#include <stdlib.h>
+#include "bibliotecas/telemetry.h"
+
+#define FRAME_PERIOD_US 20000
+#define MIN_INTERVAL_US (FRAME_PERIOD_US / 2) // O mesmo de TELEMETRY_MIN_INTERVAL_US no main.c
+#define OUTPUT_SIZE 4096
+
+static telemetry_t telemetry;
+static uint8_t output[OUTPUT_SIZE];
+static size_t output_length, output_limit;
+static unsigned failures;
+
+static void check(bool ok, const char *name)
+{
+  printf("%-48s %s\n", name, ok ? "ok" : "FALHOU");
+  if (!ok)
+    failures++;
+}
+
+// Saída que aceita no máximo output_limit bytes por chamada, como a FIFO da UART
+static size_t write_output(void *context, const uint8_t *data, size_t len)
+{
+  (void)context;
+  size_t accepted = len < output_limit ? len : output_limit;
+  if (accepted > OUTPUT_SIZE - output_length)
+    accepted = OUTPUT_SIZE - output_length;
+  for (size_t i = 0; i < accepted; ++i)
+    output[output_length++] = data[i];
+  return accepted;
+}
+
+static uint16_t get_u16(const uint8_t *in)
+{
+  return in[0] | (in[1] << 8);
+}
+
+static telemetry_record_t make_record(uint32_t timestamp_us, uint16_t n)
+{
+  telemetry_record_t record = {
+      .timestamp_us = timestamp_us,
+      .adc_x = n,
+      .adc_y = 4095 - n,
+      .pwm_red = n * 3,
+      .pwm_blue = n * 5,
+      .border_style = n % 6,
+      .flags = TELEMETRY_FLAG_LED_GREEN,
+  };
+  return record;
+}
+
+// Quadros de 20 ms com até ±4 ms de atraso do laço: nenhum é descartado
+static void test_jitter(void)
+{
+  telemetry_init(&telemetry, MIN_INTERVAL_US);
+  output_length = 0;
+  output_limit = 32;
+  srand(1);
+  bool accepted = true;
+  for (uint16_t n = 0; n < 500; ++n)
+  {
+    uint32_t jitter = rand() % 8000;
+    telemetry_record_t record = make_record(n * FRAME_PERIOD_US + jitter, n);
+    accepted &= telemetry_log(&telemetry, &record);
+    output_length = 0;
+    telemetry_drain(&telemetry, write_output, NULL);
+  }
+  check(accepted && telemetry.dropped_rate == 0 && telemetry.dropped_full == 0,
+        "500 quadros com jitter, nenhum descartado");
+}
+
+// Registros a mais no mesmo quadro contam em dropped_rate; com a saída parada
+// o anel enche e o resto conta em dropped_full. Os quadros que saem depois
+// levam os dois contadores, cada um no seu campo.
+static void test_counters(void)
+{
+  telemetry_init(&telemetry, MIN_INTERVAL_US);
+  output_length = 0;
+
+  telemetry_record_t record = make_record(0, 0);
+  telemetry_log(&telemetry, &record);
+  for (uint16_t n = 1; n <= 3; ++n)
+  {
+    record = make_record(n * 1000, n);
+    telemetry_log(&telemetry, &record);
+  }
+  for (uint16_t n = 1; n <= TELEMETRY_CAPACITY + 4; ++n)
+  {
+    record = make_record(n * FRAME_PERIOD_US, n);
+    telemetry_log(&telemetry, &record);
+  }
+  check(telemetry.dropped_rate == 3 && telemetry.dropped_full == 5, "contadores: 3 pela taxa, 5 com o anel cheio");
+
+  // Saída lenta: 7 bytes por chamada, os quadros continuam de onde pararam
+  output_limit = 7;
+  while (telemetry_drain(&telemetry, write_output, NULL) > 0)
+    ;
+  check(output_length == TELEMETRY_CAPACITY * TELEMETRY_FRAME_SIZE, "anel inteiro serializado");
+
+  bool frames_ok = true;
+  for (size_t offset = 0; offset + TELEMETRY_FRAME_SIZE <= output_length; offset += TELEMETRY_FRAME_SIZE)
+  {
+    const uint8_t *frame = &output[offset];
+    uint8_t checksum = 0;
+    for (uint8_t i = 0; i < TELEMETRY_FRAME_SIZE - 1; ++i)
+      checksum ^= frame[i];
+    uint16_t n = get_u16(&frame[6]);
+    bool ok = frame[0] == TELEMETRY_MAGIC && frame[1] == offset / TELEMETRY_FRAME_SIZE &&
+              checksum == frame[TELEMETRY_FRAME_SIZE - 1] && get_u16(&frame[8]) == 4095 - n &&
+              get_u16(&frame[10]) == n * 3 && get_u16(&frame[12]) == n * 5 && frame[14] == n % 6 &&
+              frame[15] == TELEMETRY_FLAG_LED_GREEN && get_u16(&frame[16]) == 5 && get_u16(&frame[18]) == 3;
+    if (!ok)
+    {
+      printf("  quadro %zu diferente do esperado\n", offset / TELEMETRY_FRAME_SIZE);
+      frames_ok = false;
+    }
+  }
+  check(frames_ok, "campos, checksum e contadores separados");
+}
+
+int main(void)
+{
+  test_jitter();
+  test_counters();
+  return failures ? 1 : 0;
+}
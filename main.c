@@ -1,9 +1,34 @@
 #include <stdio.h>
 #include "pico/stdlib.h"
 #include "hardware/adc.h"
-#include "hardware/pwm.h"
 #include "hardware/i2c.h"
+#include "hardware/spi.h"
+#include "hardware/uart.h"
+#include "pico/multicore.h"
+#include "pico/flash.h"
+#include "hardware/sync.h"
+#include "tusb.h"
 #include "bibliotecas/ssd1306.h"
+#include "bibliotecas/ssd1306_spi.h"
+#include "bibliotecas/ssd1306_gray.h"
+#include "bibliotecas/frame_queue.h"
+#include "bibliotecas/adc_sampler.h"
+#include "bibliotecas/frame_scheduler.h"
+#include "bibliotecas/frame_stats.h"
+#include "bibliotecas/telemetry.h"
+#include "bibliotecas/input_events.h"
+#include "bibliotecas/led_pwm.h"
+#include "bibliotecas/joystick_cal.h"
+#include "bibliotecas/hud.h"
+#include "bibliotecas/presented_state.h"
+#include "bibliotecas/fb_capture.h"
+
+// 1: pipeline em dois núcleos. O core0 lê o joystick e desenha em um quadro
+// livre, e o core1 é o dono do I2C e envia os quadros prontos ao display.
+// 0: laço único no core0, com envio parcial e assíncrono (padrão).
+#ifndef DUAL_CORE_PIPELINE
+#define DUAL_CORE_PIPELINE 0
+#endif
 
 // Definindo pinos do joystick
 static const uint32_t VRY_PIN = 27;
@@ -18,6 +43,17 @@ static const uint32_t LED_GREEN_PIN = 11;
 static const uint32_t LED_BLUE_PIN = 12;
 static const uint32_t LED_RED_PIN = 13;
 
+// Canais do motor de LEDs (ordem dos pinos passados a led_pwm_init)
+#define LED_CHANNEL_BLUE 0
+#define LED_CHANNEL_RED 1
+
+// Transições dos LEDs: atualizações por segundo feitas pela interrupção do
+// PWM, suavização ao seguir o joystick (dois quadros) e duração do
+// apagar/acender pelo botão A
+#define LED_UPDATE_RATE_HZ 1000
+#define LED_FOLLOW_FADE_MS 40
+#define LED_TOGGLE_FADE_MS 300
+
 // Definindo pinos do ssd
 static const uint32_t I2C_SDA = 14;
 static const uint32_t I2C_SCL = 15;
@@ -28,20 +64,140 @@ static const uint32_t I2C_SCL = 15;
 #define I2C_SCL 15
 #define endereco 0x3C
 
+// 1: display SSD1306 em SPI de 4 fios (módulo com pinos D/C, CS e RES) no
+// spi0 a 10 MHz, em vez do display I2C da placa. O envio de um quadro inteiro
+// cai de ~23 ms para ~0,8 ms.
+#ifndef DISPLAY_SPI
+#define DISPLAY_SPI 0
+#endif
+#define SPI_PORT spi0
+#define SPI_BAUDRATE (10 * 1000 * 1000)
+#define SPI_SCK_PIN 18
+#define SPI_MOSI_PIN 19
+#define SPI_CS_PIN 17
+#define SPI_DC_PIN 16
+#define SPI_RST_PIN 20
+
+// 1: só desenha e envia um quadro quando a posição do quadrado ou o estilo
+// da borda mudam em relação ao último quadro apresentado (e só atualiza o
+// PWM quando os níveis mudam); sem mudança o núcleo dorme até a próxima
+// amostra.
+// 0: desenha e envia todos os quadros.
+#ifndef RENDER_ON_CHANGE
+#define RENDER_ON_CHANGE 1
+#endif
+
+// 1: mostra no display as leituras do ADC, os quadros apresentados por
+// segundo e o estilo da borda. Cada campo só redesenha os caracteres que
+// mudaram, e o quadrado fica fora das linhas do HUD.
+#ifndef SHOW_HUD
+#define SHOW_HUD 0
+#endif
+#define HUD_TOP_Y 8   // Linha das leituras do ADC
+#define HUD_MARGIN 16 // Faixa de cima e de baixo reservada ao HUD
+
+// 1: bordas em 4 tons de cinza (o efeito 3D e o de profundidade ganham
+// sombreamento). Os dois planos de cada quadro se alternam no display
+// enquanto o laço espera o próximo quadro, ocupando o barramento e a CPU do
+// core0; só no laço de um núcleo e sem o HUD.
+#ifndef GRAYSCALE
+#define GRAYSCALE 0
+#endif
+#if GRAYSCALE && (DUAL_CORE_PIPELINE || SHOW_HUD)
+#error "GRAYSCALE exige DUAL_CORE_PIPELINE=0 e SHOW_HUD=0"
+#endif
+
+// Variação mínima do ADC (em contagens de 12 bits) para ser tratada como
+// movimento do joystick no modo RENDER_ON_CHANGE
+#ifndef ADC_HYSTERESIS
+#define ADC_HYSTERESIS 24
+#endif
+
+// Amostragem do joystick: valores por segundo entregues pelo decimador e
+// quantas amostras entram na média de cada valor
+#define ADC_OUTPUT_RATE_HZ 500
+#define ADC_OVERSAMPLE 16
+
+// Período de cada quadro (50 quadros por segundo)
+#define FRAME_PERIOD_US 20000
+
+// Telemetria binária pela UART0 (GP0/GP1); o texto do stdio vai só pela USB.
+// Os registros são decodificados com host/decode_telemetry.py.
+#define TELEMETRY_UART uart0
+#define TELEMETRY_TX_PIN 0
+#define TELEMETRY_RX_PIN 1
+#define TELEMETRY_BAUDRATE 115200
+#define TELEMETRY_MIN_INTERVAL_US (FRAME_PERIOD_US / 2) // Um registro por quadro, com folga para o jitter do laço
+
 // Variáveis globais
 static ssd1306_t ssd;                         // Variável global para o ssd
-static volatile bool led_green_state = false; // variável para ficar alterando o estado do led verde ao apertar o botão do joystick
-static volatile bool pwm_enabled = true;
-static volatile uint8_t border_style = 0;
-static volatile uint32_t last_button_time = 0;
-const uint32_t DEBOUNCE_DELAY = 200000; // 200ms em microssegundos
-
-void setup_pwm(uint gpio);                               // Função para configurar pinos com pwm
-void set_pwm(uint gpio, uint16_t value);                 // Função para setar valor do pwm
-uint16_t map_joystick_to_pwm(uint16_t value);            // Função para mapear valores do joystick para PWM
+#if DISPLAY_SPI
+static ssd1306_spi_t spi_context; // Controlador e pinos D/C e CS do display SPI
+#endif
+static bool led_green_state = false; // variável para ficar alterando o estado do led verde ao apertar o botão do joystick
+static bool pwm_enabled = true;
+static uint8_t border_style = 0;
+const uint32_t DEBOUNCE_DELAY = 200000; // 200ms em microssegundos, por pino
+
+// Bordas dos botões: a interrupção só enfileira, o laço principal filtra e trata
+#define INPUT_EVENTS_PER_FRAME 8
+static input_events_t input;
+static void handle_input_events(void);
+
+// Instrumentação dos quadros. Envio e latência (leitura do ADC até o fim do
+// envio pelo I2C) são registrados por quem conclui o envio: a interrupção do
+// DMA no modo de um núcleo ou o core1 no pipeline. Envie 's' pela serial para
+// imprimir os histogramas.
+static frame_scheduler_t scheduler;
+static frame_histogram_t stats_interval; // Intervalo entre o início de quadros consecutivos
+static frame_histogram_t stats_sample;
+static frame_histogram_t stats_render;
+static frame_histogram_t stats_flush;
+static frame_histogram_t stats_latency;
+static frame_histogram_t stats_button; // Borda do botão até o fim do envio do quadro que a mostra
+static uint32_t input_pending_us;      // Borda mais antiga ainda não mostrada (0 = nenhuma)
+
+static void print_frame_stats(void);
+
+// Calibração do joystick (centro, curso e zona morta) e as tabelas de
+// posição e brilho geradas a partir dela. Carregada da flash no boot; sem
+// calibração gravada o centro é aprendido no primeiro segundo, com o joystick
+// solto. Envie 'c' pela serial para recalibrar tudo e gravar.
+static joystick_cal_t joystick;
+
+static uint32_t frames_skipped; // Quadros sem mudança, nem desenhados nem enviados
+
+static telemetry_t telemetry;
+static size_t telemetry_uart_write(void *context, const uint8_t *data, size_t len);
+
+// Captura dos quadros apresentados pela USB, junto com o texto do stdio,
+// decodificada com host/decode_fbcapture.py. Envie 'f' pela serial para
+// ligar ou desligar.
+static fb_capture_t capture;
+static size_t capture_usb_write(void *context, const uint8_t *data, size_t len);
+
+#if DUAL_CORE_PIPELINE
+#define PIPELINE_FRAMES 3 // Um sendo desenhado, um sendo enviado e um pronto
+
+static ssd1306_t frames[PIPELINE_FRAMES];                                            // Um display por buffer: o core0 desenha e o core1 envia por ele
+static uint8_t frame_buffers[PIPELINE_FRAMES][SSD1306_BUFFER_SIZE(WIDTH, HEIGHT)]; // ram_buffer de cada quadro
+static uint64_t frame_sample_us[PIPELINE_FRAMES];                                    // Instante da leitura do ADC de cada quadro
+static uint32_t frame_input_us[PIPELINE_FRAMES];                                     // Borda de botão mostrada pelo quadro (0 = nenhuma)
+static frame_pipeline_t pipeline;
+
+static void display_core_main(void); // Laço do core1: envia os quadros prontos
+#else
+static volatile uint64_t flush_start_us;  // Início do envio em andamento
+static volatile uint64_t flush_sample_us; // Leitura do ADC mostrada pelo envio em andamento
+static volatile uint32_t flush_input_us;  // Borda de botão mostrada pelo envio em andamento (0 = nenhuma)
+
+static void on_flush_done(ssd1306_t *display); // Callback do fim do envio (STOP final no I2C)
+#endif
+
 static void gpio_irq_handle(uint gpio, uint32_t events); // Função para a interrupção
 
-// Estrutura para armazenar os limites de cada estilo de borda
+// Estrutura para armazenar os limites de cada estilo de borda, como a margem
+// livre a partir de cada lado do display
 typedef struct
 {
     uint8_t left;
@@ -51,26 +207,60 @@ typedef struct
 } BorderLimits;
 
 // Array global para armazenar os limites de cada estilo
-static BorderLimits border_limits[] = {
-    {1, WIDTH - SQUARE_SIZE - 1, 1, HEIGHT - SQUARE_SIZE - 1}, // Estilo 0: Minimalista
-    {4, WIDTH - SQUARE_SIZE - 4, 4, HEIGHT - SQUARE_SIZE - 4}, // Estilo 1: Moldura dupla
-    {5, WIDTH - SQUARE_SIZE - 5, 5, HEIGHT - SQUARE_SIZE - 5}, // Estilo 2: Cantos estilizados
-    {2, WIDTH - SQUARE_SIZE - 2, 2, HEIGHT - SQUARE_SIZE - 2}, // Estilo 3: Efeito 3D
-    {1, WIDTH - SQUARE_SIZE - 1, 1, HEIGHT - SQUARE_SIZE - 1}, // Estilo 4: Cantos arredondados
-    {6, WIDTH - SQUARE_SIZE - 6, 6, HEIGHT - SQUARE_SIZE - 6}  // Estilo 5: Efeito profundidade
+static const BorderLimits border_limits[] = {
+    {1, 1, 1, 1}, // Estilo 0: Minimalista
+    {4, 4, 4, 4}, // Estilo 1: Moldura dupla
+    {5, 5, 5, 5}, // Estilo 2: Cantos estilizados
+    {2, 2, 2, 2}, // Estilo 3: Efeito 3D
+    {1, 1, 1, 1}, // Estilo 4: Cantos arredondados
+    {6, 6, 6, 6}  // Estilo 5: Efeito profundidade
 };
 
-// Função para aplicar limites baseados no estilo atual
-void apply_square_limits(int16_t *square_x, int16_t *square_y, uint8_t style)
+// Quadrado controlado pelo joystick: sprite que guarda o fundo sob ele, de
+// modo que movê-lo só restaura a posição antiga e desenha a nova
+static ssd1306_sprite_t square;
+static uint8_t square_background[SSD1306_SPRITE_BACKGROUND_SIZE(SQUARE_SIZE, SQUARE_SIZE)];
+
+#if GRAYSCALE
+// Planos de cinza desenhados no lugar do ram_buffer. O quadrado fica no
+// nível 3, com um sprite em cada plano.
+static ssd1306_gray_t gray;
+static uint8_t gray_planes[2][SSD1306_BUFFER_SIZE(WIDTH, HEIGHT)];
+static ssd1306_sprite_t square_high;
+static uint8_t square_high_background[SSD1306_SPRITE_BACKGROUND_SIZE(SQUARE_SIZE, SQUARE_SIZE)];
+#endif
+
+#if SHOW_HUD
+// Campos do HUD: leituras do ADC na linha de cima, quadros por segundo e
+// estilo da borda na de baixo
+enum
 {
-    BorderLimits limits = border_limits[style % 6];
+    HUD_ADC_X,
+    HUD_ADC_Y,
+    HUD_FPS,
+    HUD_STYLE,
+    HUD_FIELDS
+};
+static hud_field_t hud[HUD_FIELDS];
 
-    // Aplica os limites
-    *square_x = (*square_x < limits.left) ? limits.left : (*square_x > limits.right) ? limits.right
-                                                                                     : *square_x;
+static void draw_hud(ssd1306_t *display, uint16_t adc_x, uint16_t adc_y, uint16_t fps, uint8_t style);
+static void invalidate_hud(void);
+#if !DUAL_CORE_PIPELINE
+static void flush_hud(ssd1306_t *display); // No pipeline o quadro vai inteiro
+#endif
+#endif
 
-    *square_y = (*square_y < limits.top) ? limits.top : (*square_y > limits.bottom) ? limits.bottom
-                                                                                    : *square_y;
+// Função para aplicar limites baseados no estilo atual e no tamanho do display
+static void set_square_bounds(uint8_t style)
+{
+    BorderLimits limits = border_limits[style % 6];
+#if SHOW_HUD
+    // Um glifo desenhado sob o quadrado apagaria o fundo salvo pelo sprite
+    limits.top = limits.top > HUD_MARGIN ? limits.top : HUD_MARGIN;
+    limits.bottom = limits.bottom > HUD_MARGIN ? limits.bottom : HUD_MARGIN;
+#endif
+    ssd1306_sprite_set_bounds(&square, limits.left, ssd.width - SQUARE_SIZE - limits.right,
+                              limits.top, ssd.height - SQUARE_SIZE - limits.bottom);
 }
 
 int main(void)
@@ -78,10 +268,18 @@ int main(void)
     // Ativando comunição serial
     stdio_init_all();
 
+    // UART exclusiva da telemetria
+    uart_init(TELEMETRY_UART, TELEMETRY_BAUDRATE);
+    gpio_set_function(TELEMETRY_TX_PIN, GPIO_FUNC_UART);
+    gpio_set_function(TELEMETRY_RX_PIN, GPIO_FUNC_UART);
+    telemetry_init(&telemetry, TELEMETRY_MIN_INTERVAL_US);
+    fb_capture_init(&capture);
+
     // Configuração do ADC
     adc_init();
     adc_gpio_init(VRX_PIN);
     adc_gpio_init(VRY_PIN);
+    adc_sampler_init(ADC_OUTPUT_RATE_HZ, ADC_OVERSAMPLE); // Amostragem contínua via DMA, independente do laço
 
     // Inicializando 2 botões
     gpio_init(SW_PIN);
@@ -96,11 +294,27 @@ int main(void)
     gpio_pull_up(BUTTON_A);
 
     // Configuração do PWM para LEDs
-    setup_pwm(LED_RED_PIN);
-    setup_pwm(LED_BLUE_PIN);
+    const uint32_t led_pins[] = {LED_BLUE_PIN, LED_RED_PIN};
+    led_pwm_init(led_pins, sizeof(led_pins) / sizeof(led_pins[0]), LED_UPDATE_RATE_HZ);
     gpio_init(LED_GREEN_PIN);
     gpio_set_dir(LED_GREEN_PIN, GPIO_OUT);
 
+#if DISPLAY_SPI
+    // SPI no modo 0 (padrão do spi_init), só com SCK e MOSI; D/C e CS são GPIO
+    spi_init(SPI_PORT, SPI_BAUDRATE);
+    gpio_set_function(SPI_SCK_PIN, GPIO_FUNC_SPI);
+    gpio_set_function(SPI_MOSI_PIN, GPIO_FUNC_SPI);
+
+    // Pulso no RES exigido pelo SSD1306 depois de ligar
+    gpio_init(SPI_RST_PIN);
+    gpio_set_dir(SPI_RST_PIN, GPIO_OUT);
+    gpio_put(SPI_RST_PIN, 0);
+    sleep_ms(1);
+    gpio_put(SPI_RST_PIN, 1);
+
+    ssd1306_init(&ssd, WIDTH, HEIGHT, false, endereco, NULL);
+    ssd1306_spi_attach(&ssd, &spi_context, SPI_PORT, SPI_DC_PIN, SPI_CS_PIN);
+#else
     // Inicialização do I2C a 400 kHz
     i2c_init(I2C_PORT, 400 * 1000);
 
@@ -112,22 +326,85 @@ int main(void)
 
     // Inicialização e configuração do ssd SSD1306                                               // Cria a estrutura do ssd
     ssd1306_init(&ssd, WIDTH, HEIGHT, false, endereco, I2C_PORT); // Inicializa o ssd com as especificações fornecidas
+#endif
     ssd1306_config(&ssd);                                         // Configura os parâmetros do ssd
-    ssd1306_send_data(&ssd);                                      // Envia os dados iniciais de configuração para o ssd
+#if GRAYSCALE
+    ssd1306_async_init(&ssd, NULL); // Os envios são trechos das fatias, não quadros: sem medição por envio
+#elif !DUAL_CORE_PIPELINE
+    ssd1306_async_init(&ssd, on_flush_done); // Reserva o DMA para enviar quadros sem bloquear a CPU
+#endif
+    ssd1306_send_data(&ssd); // Envia os dados iniciais de configuração para o ssd
 
     // Limpeza do ssd. O ssd inicia com todos os pixels apagados.
     ssd1306_fill(&ssd, false); // Preenche o ssd com o valor especificado (false = apagado)
     ssd1306_send_data(&ssd);   // Envia os dados de preenchimento para o ssd
 
+    frame_histogram_init(&stats_interval, "intervalo");
+    frame_histogram_init(&stats_sample, "amostra");
+    frame_histogram_init(&stats_render, "desenho");
+    frame_histogram_init(&stats_flush, "envio");
+    frame_histogram_init(&stats_latency, "latencia");
+    frame_histogram_init(&stats_button, "botao");
+
+#if DUAL_CORE_PIPELINE
+    // A partir daqui só o core1 usa o barramento, pelos displays dos quadros
+    for (uint8_t i = 0; i < PIPELINE_FRAMES; ++i)
+    {
+        ssd1306_init_with_buffer(&frames[i], WIDTH, HEIGHT, false, endereco, NULL, frame_buffers[i]);
+        ssd1306_set_transport(&frames[i], ssd.transport, ssd.bus); // Mesmo display, mesmo transporte
+    }
+    frame_pipeline_init(&pipeline, PIPELINE_FRAMES);
+    multicore_launch_core1(display_core_main);
+#endif
+
     uint16_t adc_value_x;
     uint16_t adc_value_y;
 
     int16_t square_x;
     int16_t square_y;
 
-    // Configuração da interrupção com o callback
-    gpio_set_irq_enabled_with_callback(SW_PIN, GPIO_IRQ_EDGE_FALL, true, &gpio_irq_handle);
-    gpio_set_irq_enabled_with_callback(BUTTON_A, GPIO_IRQ_EDGE_FALL, true, &gpio_irq_handle);
+    ssd1306_sprite_init(&square, SQUARE_SIZE, SQUARE_SIZE, NULL, SSD1306_SPRITE_BACKGROUND, square_background);
+#if GRAYSCALE
+    ssd1306_gray_init(&gray, &ssd, gray_planes[0], gray_planes[1]);
+    ssd1306_sprite_init(&square_high, SQUARE_SIZE, SQUARE_SIZE, NULL, SSD1306_SPRITE_BACKGROUND, square_high_background);
+#endif
+#if SHOW_HUD
+    hud_field_init(&hud[HUD_ADC_X], 8, HUD_TOP_Y, 5);
+    hud_field_init(&hud[HUD_ADC_Y], ssd.width / 2, HUD_TOP_Y, 5);
+    hud_field_init(&hud[HUD_FPS], 8, ssd.height - HUD_MARGIN, 5);
+    hud_field_init(&hud[HUD_STYLE], ssd.width - 32, ssd.height - HUD_MARGIN, 2);
+
+    // Quadros apresentados no último segundo completo
+    uint32_t hud_second_us = time_us_32();
+    uint16_t hud_frames = 0;
+    uint16_t hud_fps = 0;
+#endif
+    set_square_bounds(border_style);
+
+    joystick_cal_init(&joystick, ssd.width - SQUARE_SIZE, ssd.height - SQUARE_SIZE);
+    if (!joystick_cal_load(&joystick))
+        joystick_cal_start(&joystick, false, time_us_32());
+
+    // Estado do último quadro apresentado; começa inválido, o que força o
+    // primeiro quadro. Sem RENDER_ON_CHANGE a histerese fica desligada.
+    presented_state_t presented;
+    presented_state_init(&presented, RENDER_ON_CHANGE ? ADC_HYSTERESIS : 0);
+
+#if !DUAL_CORE_PIPELINE
+    // Estilo do último quadro desenhado, usado para redesenhar apenas o que mudou
+    uint8_t drawn_style = 0xFF;
+#endif
+
+    // Configuração da interrupção com o callback. As duas bordas são
+    // registradas para que o debounce acompanhe também a soltura do botão.
+    input_events_init(&input, DEBOUNCE_DELAY);
+    input_events_add_pin(&input, SW_PIN, !gpio_get(SW_PIN));
+    input_events_add_pin(&input, BUTTON_A, !gpio_get(BUTTON_A));
+    gpio_set_irq_enabled_with_callback(SW_PIN, GPIO_IRQ_EDGE_FALL | GPIO_IRQ_EDGE_RISE, true, &gpio_irq_handle);
+    gpio_set_irq_enabled_with_callback(BUTTON_A, GPIO_IRQ_EDGE_FALL | GPIO_IRQ_EDGE_RISE, true, &gpio_irq_handle);
+
+    uint64_t frame_start_us = time_us_64();
+    frame_scheduler_init(&scheduler, FRAME_PERIOD_US);
 
     while (true)
     {
@@ -137,16 +414,29 @@ int main(void)
         no caso, ele lia nessa configuração o x na direção vertical do joystick e y na honrizontal.
         */
 
-        // Seleciona o ADC para eixo Y. O pino 26 como entrada analógica
-        adc_select_input(0);
-        adc_value_y = adc_read(); // Inverte o valor lido do eixo Y
+        uint64_t sample_us = time_us_64();
+        frame_histogram_add(&stats_interval, sample_us - frame_start_us);
+        frame_start_us = sample_us;
 
-        // Seleciona o ADC para eixo X. O pino 27 como entrada analógica
-        adc_select_input(1);
-        adc_value_x = adc_read(); // Inverte o valor lido do eixo X
+        handle_input_events(); // Trata de uma vez os botões pressionados desde o último quadro
+
+        // Últimos valores decimados: entrada 0 (pino 26) é o eixo Y e entrada 1 (pino 27) o eixo X
+        adc_sampler_read(&adc_value_y, &adc_value_x);
+        if (joystick_cal_feed(&joystick, adc_value_x, adc_value_y, time_us_32()))
+        {
+            for (int axis = 0; axis < JOYSTICK_CAL_AXES; ++axis)
+                printf("calibracao eixo %c: min=%u centro=%u max=%u zona morta=%u\n", "XY"[axis],
+                       joystick.axis[axis].min, joystick.axis[axis].center, joystick.axis[axis].max,
+                       joystick.axis[axis].deadzone);
+            if (joystick.full)
+                printf("%s\n", joystick_cal_save(&joystick) ? "calibracao gravada" : "falha ao gravar a calibracao");
+        }
+        // Ruído abaixo da histerese mantém o valor já apresentado
+        adc_value_x = presented_state_hold_adc(&presented, 0, adc_value_x);
+        adc_value_y = presented_state_hold_adc(&presented, 1, adc_value_y);
+        uint64_t render_start_us = time_us_64();
+        frame_histogram_add(&stats_sample, render_start_us - sample_us);
 
-        printf("Valor em y: %d \n", adc_value_y); // prints para poder debbugar o código
-        printf("Valor em x: %d \n", adc_value_x); // prints para poder debbugar o código
 
         /*
         testes
@@ -163,84 +453,321 @@ int main(void)
 
         */
 
-        // Calcula a posição do quadrado no eixo X
-        square_x = (WIDTH / 2 - SQUARE_SIZE / 2) + ((int32_t)(adc_value_x - 2048) * (WIDTH - SQUARE_SIZE)) / 4096;
-
-        // Calcula a posição do quadrado no eixo Y (invertido(sinal de mensos) porque estava com erro.)
-        square_y = (HEIGHT / 2 - SQUARE_SIZE / 2) - ((int32_t)(adc_value_y - 2048) * (HEIGHT - SQUARE_SIZE)) / 4096;
+        // Posição do quadrado nos eixos X e Y, pelas tabelas da calibração (o
+        // eixo Y já sai invertido, já que na tela ele cresce para baixo)
+        square_x = joystick_cal_screen(&joystick, 0, adc_value_x);
+        square_y = joystick_cal_screen(&joystick, 1, adc_value_y);
 
         // Limites do quadrado no eixo X e Y de forma dinâmica
 
-        apply_square_limits(&square_x, &square_y, border_style);
-
-        // Atualização do ssd
-        ssd1306_fill(&ssd, false);
-        draw_border(&ssd, border_style);
-        draw_square(&ssd, square_x, square_y);
-        ssd1306_send_data(&ssd);
+        ssd1306_sprite_clamp(&square, &square_x, &square_y);
 
         // configurando pwm pros leds.
 
-        set_pwm(LED_BLUE_PIN, map_joystick_to_pwm(adc_value_y));
-        set_pwm(LED_RED_PIN, map_joystick_to_pwm(adc_value_x));
+        uint16_t pwm_blue = joystick_cal_brightness(&joystick, 1, adc_value_y);
+        uint16_t pwm_red = joystick_cal_brightness(&joystick, 0, adc_value_x);
 
-        sleep_ms(20); // Pequeno delay para estabilidade
+        presented_screen_t screen = {.square_x = square_x, .square_y = square_y, .border_style = border_style};
+#if SHOW_HUD
+        if (time_us_32() - hud_second_us >= 1000000)
+        {
+            hud_second_us = time_us_32();
+            hud_fps = hud_frames;
+            hud_frames = 0;
+        }
+        screen.adc_x = adc_value_x;
+        screen.adc_y = adc_value_y;
+        screen.fps = hud_fps;
+#endif
+        bool screen_changed = presented_state_set_screen(&presented, &screen);
+        bool pwm_changed = presented_state_set_pwm(&presented, pwm_red, pwm_blue);
+#if !RENDER_ON_CHANGE
+        screen_changed = pwm_changed = true;
+#endif
+
+        if (pwm_changed)
+        {
+            // A interrupção do PWM faz a transição até os novos níveis
+            led_pwm_set(LED_CHANNEL_BLUE, pwm_blue, LED_FOLLOW_FADE_MS);
+            led_pwm_set(LED_CHANNEL_RED, pwm_red, LED_FOLLOW_FADE_MS);
+        }
+
+        if (!screen_changed)
+        {
+            frames_skipped++; // Nada novo na tela: sem desenho e sem envio
+        }
+        else
+        {
+#if SHOW_HUD
+            hud_frames++;
+#endif
+
+#if DUAL_CORE_PIPELINE
+            // Desenha o quadro completo num buffer livre e o entrega ao core1. Sem
+            // buffer livre (envio atrasado) este quadro é pulado.
+            uint8_t frame;
+            if (frame_pipeline_acquire(&pipeline, &frame))
+            {
+                ssd1306_t *render = &frames[frame];
+                draw_border_copy(render, border_style);
+#if SHOW_HUD
+                invalidate_hud(); // O buffer adquirido não guarda o HUD do quadro anterior
+                draw_hud(render, adc_value_x, adc_value_y, hud_fps, border_style);
+#endif
+                draw_square(render, square_x, square_y);
+                fb_capture_frame(&capture, render, (uint32_t)sample_us);
+                frame_sample_us[frame] = sample_us;
+                frame_input_us[frame] = input_pending_us;
+                input_pending_us = 0;
+                frame_histogram_add(&stats_render, time_us_64() - render_start_us);
+                frame_pipeline_submit(&pipeline, frame);
+                __sev(); // Só acorda o core1; o quadro vai pela fila
+            }
+            else
+            {
+                presented_state_invalidate(&presented); // Quadro não apresentado: tenta de novo no próximo
+            }
+#elif GRAYSCALE
+            // Mesmo esquema do modo monocromático, nos dois planos. As
+            // fatias saem em ssd1306_gray_run_until, até pouco antes do prazo.
+            if (border_style != drawn_style)
+            {
+                drawn_style = border_style;
+                ssd1306_gray_border(&gray, drawn_style);
+                ssd1306_sprite_invalidate(&square);
+                ssd1306_sprite_invalidate(&square_high);
+            }
+            ssd1306_sprite_move(&gray.plane[0], &square, square_x, square_y);
+            ssd1306_sprite_move(&gray.plane[1], &square_high, square_x, square_y);
+            ssd1306_gray_present(&gray);
+            input_pending_us = 0;
+            frame_histogram_add(&stats_render, time_us_64() - render_start_us);
+            fb_capture_frame(&capture, &gray.plane[1], (uint32_t)sample_us); // Só o plano de peso 2
+#else
+            // Atualização do ssd. Quando o estilo muda, a camada pré-calculada da
+            // borda substitui o quadro inteiro e o fundo salvo pelo quadrado e o
+            // texto do HUD são descartados; nos demais quadros só o quadrado se
+            // move, devolvendo o fundo da posição anterior, e o HUD redesenha
+            // os caracteres que mudaram.
+            if (border_style != drawn_style)
+            {
+                drawn_style = border_style;
+                draw_border_copy(&ssd, drawn_style);
+                ssd1306_sprite_invalidate(&square);
+#if SHOW_HUD
+                invalidate_hud();
+#endif
+            }
+#if SHOW_HUD
+            draw_hud(&ssd, adc_value_x, adc_value_y, hud_fps, drawn_style);
+#endif
+            ssd1306_sprite_move(&ssd, &square, square_x, square_y);
+
+            ssd1306_wait_flush(&ssd); // O envio anterior precisa ter terminado para medir o próximo
+            flush_start_us = time_us_64();
+            flush_sample_us = sample_us;
+            flush_input_us = input_pending_us;
+            input_pending_us = 0;
+            frame_histogram_add(&stats_render, flush_start_us - render_start_us);
+#if SHOW_HUD
+            flush_hud(&ssd); // Células do HUD em janelas próprias, bloqueando com o barramento livre
+#endif
+            ssd1306_send_dirty_async(&ssd); // Envia só a região alterada via DMA; o próximo quadro já pode ser desenhado
+            fb_capture_frame(&capture, &ssd, (uint32_t)sample_us); // O envio usa a cópia no dma_buffer
+#endif
+        }
+
+        // Registro de telemetria (substitui os printf de depuração): só copia
+        // o registro para o anel; o envio acontece no drain abaixo
+        telemetry_record_t record = {
+            .timestamp_us = (uint32_t)sample_us,
+            .adc_x = adc_value_x,
+            .adc_y = adc_value_y,
+            .pwm_red = pwm_red,
+            .pwm_blue = pwm_blue,
+            .border_style = border_style,
+            .flags = (pwm_enabled ? TELEMETRY_FLAG_PWM_ENABLED : 0) | (led_green_state ? TELEMETRY_FLAG_LED_GREEN : 0),
+        };
+        telemetry_log(&telemetry, &record);
+        telemetry_drain(&telemetry, telemetry_uart_write, NULL);
+        fb_capture_drain(&capture, capture_usb_write, NULL);
+
+        int command = getchar_timeout_us(0);
+        if (command == 's')
+        {
+            print_frame_stats();
+        }
+        else if (command == 'c')
+        {
+            printf("calibracao: solte o joystick por 1 s e depois gire-o ate os batentes por 4 s\n");
+            joystick_cal_start(&joystick, true, time_us_32());
+        }
+        else if (command == 'f')
+        {
+            if (capture.enabled)
+                fb_capture_stop(&capture);
+            else
+                fb_capture_start(&capture);
+        }
+
+#if GRAYSCALE
+        ssd1306_gray_run_until(&gray, scheduler.deadline); // Alterna os planos até pouco antes do prazo do próximo quadro
+#endif
+        frame_scheduler_wait(&scheduler); // Dorme (WFE) até o prazo do próximo quadro; acorda antes só para tratar interrupções
     }
 
     return 0;
 }
 
-// Configuração do PWM para o LED
-void setup_pwm(uint gpio)
+#if DUAL_CORE_PIPELINE
+// Laço do core1: dorme (WFE) até o aviso (SEV) do core0 e envia o quadro
+// pronto mais recente. Quadros que ficaram para trás são descartados pela
+// fila (pipeline.dropped). A FIFO entre núcleos fica para o flash_safe_execute,
+// que a usa para pausar este núcleo enquanto a calibração é gravada.
+static void display_core_main(void)
 {
-    gpio_set_function(gpio, GPIO_FUNC_PWM);
-    uint slice = pwm_gpio_to_slice_num(gpio);
-    pwm_config config = pwm_get_default_config();
-    pwm_config_set_clkdiv(&config, 1.0f); // Define o divisor de clock para evitar flickering
-    pwm_config_set_wrap(&config, 4095);   // Mesma resolução do ADC
-    pwm_init(slice, &config, true);
+    flash_safe_execute_core_init();
+
+    while (true)
+    {
+        __wfe(); // Um SEV feito antes de chegar aqui não se perde: o WFE retorna na hora
+
+        uint8_t frame;
+        while (frame_pipeline_take_latest(&pipeline, &frame))
+        {
+            uint64_t start_us = time_us_64();
+            ssd1306_send_data(&frames[frame]);
+            uint64_t end_us = time_us_64();
+            frame_histogram_add(&stats_flush, end_us - start_us);
+            frame_histogram_add(&stats_latency, end_us - frame_sample_us[frame]);
+            if (frame_input_us[frame])
+                frame_histogram_add(&stats_button, (uint32_t)end_us - frame_input_us[frame]);
+            frame_pipeline_release(&pipeline, frame);
+        }
+    }
+}
+#else
+// Chamado na interrupção de STOP do I2C quando o último byte do quadro saiu
+// pelo barramento (não no fim do DMA, que deixa até 16 bytes na FIFO)
+static void on_flush_done(ssd1306_t *display)
+{
+    (void)display;
+    uint64_t end_us = time_us_64();
+    frame_histogram_add(&stats_flush, end_us - flush_start_us);
+    frame_histogram_add(&stats_latency, end_us - flush_sample_us);
+    if (flush_input_us)
+        frame_histogram_add(&stats_button, (uint32_t)end_us - flush_input_us);
+}
+#endif
+
+#if SHOW_HUD
+static void draw_hud(ssd1306_t *display, uint16_t adc_x, uint16_t adc_y, uint16_t fps, uint8_t style)
+{
+    hud_field_printf(display, &hud[HUD_ADC_X], "X%4u", adc_x);
+    hud_field_printf(display, &hud[HUD_ADC_Y], "Y%4u", adc_y);
+    hud_field_printf(display, &hud[HUD_FPS], "%2uFPS", fps);
+    hud_field_printf(display, &hud[HUD_STYLE], "B%u", style);
+}
+
+static void invalidate_hud(void)
+{
+    for (int i = 0; i < HUD_FIELDS; ++i)
+        hud_field_invalidate(&hud[i]);
+}
+
+#if !DUAL_CORE_PIPELINE
+static void flush_hud(ssd1306_t *display)
+{
+    for (int i = 0; i < HUD_FIELDS; ++i)
+        hud_field_flush(display, &hud[i]);
+}
+#endif
+#endif
+
+// Saída da telemetria: escreve só o que cabe na FIFO da UART, sem bloquear
+static size_t telemetry_uart_write(void *context, const uint8_t *data, size_t len)
+{
+    (void)context;
+    size_t written = 0;
+    while (written < len && uart_is_writable(TELEMETRY_UART))
+        uart_putc_raw(TELEMETRY_UART, data[written++]);
+    return written;
 }
 
-// Configura o valor PWM para um LED
-void set_pwm(uint gpio, uint16_t value)
+// Saída da captura: escreve só o que cabe no buffer do CDC, sem bloquear. O
+// tud_task do stdio_usb roda numa interrupção deste núcleo, então ela fica
+// desligada enquanto os bytes entram no buffer.
+static size_t capture_usb_write(void *context, const uint8_t *data, size_t len)
 {
-    if (pwm_enabled)
-        pwm_set_gpio_level(gpio, value);
-    else
-        pwm_set_gpio_level(gpio, 0);
+    (void)context;
+    uint32_t interrupts = save_and_disable_interrupts();
+    uint32_t available = tud_cdc_write_available();
+    uint32_t written = tud_cdc_write(data, len < available ? len : available);
+    tud_cdc_write_flush();
+    restore_interrupts(interrupts);
+    return written;
 }
 
-// Função para mapear valores do joystick para PWM
-uint16_t map_joystick_to_pwm(uint16_t value)
+static void print_frame_stats(void)
 {
-    int16_t centered = value - 2048;
-    if (abs(centered) < 100)
-        return 0; // Zona morta
-    return (uint16_t)abs(centered);
+    uint32_t fps_x10 = stats_interval.count ? 10000000ull * stats_interval.count / stats_interval.total_us : 0;
+    printf("quadros=%lu perdidos=%lu pulados=%lu fps=%lu.%lu\n",
+           (unsigned long)scheduler.frames, (unsigned long)scheduler.missed, (unsigned long)frames_skipped,
+           (unsigned long)(fps_x10 / 10), (unsigned long)(fps_x10 % 10));
+#if DUAL_CORE_PIPELINE
+    printf("descartados=%lu\n", (unsigned long)pipeline.dropped);
+#endif
+#if GRAYSCALE
+    printf("fatias de cinza=%lu\n", (unsigned long)gray.planes_shown);
+#endif
+    frame_histogram_print(&stats_interval);
+    frame_histogram_print(&stats_sample);
+    frame_histogram_print(&stats_render);
+    frame_histogram_print(&stats_flush);
+    frame_histogram_print(&stats_latency);
+    frame_histogram_print(&stats_button);
+    printf("bordas perdidas=%lu\n", (unsigned long)input.overflows);
+    printf("telemetria descartada: cheia=%lu taxa=%lu\n",
+           (unsigned long)telemetry.dropped_full, (unsigned long)telemetry.dropped_rate);
+    printf("captura: quadros=%lu descartados=%lu\n", (unsigned long)capture.captured, (unsigned long)capture.dropped);
 }
 
+// Interrupção dos botões: só registra a borda com o instante e o nível do pino
 static void gpio_irq_handle(uint gpio, uint32_t events)
 {
-    // Cria uma varíavel que pega o tempo atual do sistema em microsegundos.
-    uint32_t current_time_us = to_us_since_boot(get_absolute_time());
+    (void)events;
+    input_events_push_edge(&input, gpio, gpio_get(gpio), time_us_32());
+}
 
-    if (current_time_us - last_button_time > DEBOUNCE_DELAY)
+// Consome em lote os eventos já filtrados e aplica as ações dos botões
+static void handle_input_events(void)
+{
+    input_event_t events[INPUT_EVENTS_PER_FRAME];
+    size_t count = input_events_poll(&input, time_us_32(), events, INPUT_EVENTS_PER_FRAME);
 
+    for (size_t i = 0; i < count; ++i)
     {
-        last_button_time = current_time_us;
+        if (!events[i].pressed)
+            continue;
 
-        if (gpio == SW_PIN)
+        if (events[i].gpio == SW_PIN)
         {
             led_green_state = !led_green_state;
             gpio_put(LED_GREEN_PIN, led_green_state);
 
             border_style++;
             border_style = (border_style >= 5) ? 0 : border_style;
+            set_square_bounds(border_style);
+
+            // Só o joystick muda a tela: mede até o envio do quadro com o novo estilo
+            if (!input_pending_us)
+                input_pending_us = events[i].timestamp_us ? events[i].timestamp_us : 1;
         }
 
-        else if (gpio == BUTTON_A)
+        else if (events[i].gpio == BUTTON_A)
         {
             pwm_enabled = !pwm_enabled; // Troca estado do pwm toda vez que for apertado
+            led_pwm_set_enabled(pwm_enabled, LED_TOGGLE_FADE_MS);
         }
     }
 }